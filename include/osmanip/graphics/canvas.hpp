@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_CANVAS_HPP
 #define OSMANIP_CANVAS_HPP
@@ -19,6 +20,11 @@
 //     Headers
 //====================================================
 
+//My headers
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/gradient.hpp>
+
 //STD headers
 #include <vector>
 #include <string>
@@ -49,6 +55,7 @@ namespace osm
   /**
    * @brief Instances of this class are used to draw in a limited 2D space. All the functions that modify the canvas do it internally; to make the changes effective in the console, you must use the refresh method.
    * 
+   * @details The SGR sequences of a feat become the style of the cell. Anything else in the feat, e.g. a cursor movement or a hyperlink, is kept as it is and written before the char.
    */
   class Canvas
    {
@@ -64,7 +71,9 @@ namespace osm
      //====================================================
      void enableFrame( bool frame_enabled );
      void setFrame( FrameStyle, const std::string& feat = "" );
+     void setFrame( FrameStyle, StyleHandle style );
      void setBackground( char c, const std::string& feat = "" );
+     void setBackground( char c, StyleHandle style );
      void setWidth( uint32_t width );
      void setHeight( uint32_t height );
 
@@ -84,6 +93,8 @@ namespace osm
      //====================================================
      void clear();
      void put( uint32_t x, uint32_t y, char c, const std::string& feat = "" );
+     void put( uint32_t x, uint32_t y, char c, StyleHandle style );
+     void fillGradient( uint32_t x, uint32_t y, uint32_t width, uint32_t height, char c, const Gradient& gradient, bool vertical = false );
      void refresh();
 
     private:
@@ -94,16 +105,26 @@ namespace osm
      bool frame_enabled_;
      FrameStyle frame_style_;
      std::string frame_feat_;
+     StyleHandle frame_handle_;
      char bg_char_;
      std::string bg_feat_;
+     StyleHandle bg_handle_;
      std::vector<char> char_buffer_;
-     std::vector<std::string> feat_buffer_;
+     std::vector<StyleHandle> style_buffer_;
+     std::vector<std::string> extras_;
+     std::vector<uint32_t> extra_buffer_;
+     uint32_t frame_extra_, bg_extra_;
+     std::string last_feat_;
+     StyleHandle last_handle_;
+     uint32_t last_extra_;
      bool already_drawn_;
 
      //====================================================
      //     Private methods
      //====================================================
      void resizeCanvas();
+     uint32_t addExtra( const std::string& feat );
+     void setExtra( uint32_t p, uint32_t extra );
 
     protected:
 
@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_PLOT2DCANVAS
 #define OSMANIP_PLOT2DCANVAS
@@ -78,13 +79,28 @@ namespace osm
       */
      template <typename Y, typename X>
      inline void draw( std::function<Y( X )> function, char c, const std::string& feat = "" )
+      {
+       draw( function, c, intern( feat ) );
+      }
+
+     /**
+      * @brief Same as above, with the interned style of the char.
+      * 
+      * @tparam Y Type-argument of the given function.
+      * @tparam X Type-return of the given function.
+      * @param function The input function.
+      * @param c The char to represent a function.
+      * @param style The style of the char.
+      */
+     template <typename Y, typename X>
+     inline void draw( std::function<Y( X )> function, char c, StyleHandle style )
       {
        for( uint32_t x = 0; x < width_; x++ )
         {
          float real_x = offset_x_ + x * scale_x_;
          Y real_y = function( real_x );
          uint32_t y = std::round( ( real_y - offset_y_ ) / scale_y_ );
-         if( y > 0 && y < height_ ) put( x, y, c, feat );
+         if( y > 0 && y < height_ ) put( x, y, c, style );
         }
       }
 
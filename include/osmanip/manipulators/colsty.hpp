@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_COLSTY_HPP
 #define OSMANIP_COLSTY_HPP
@@ -21,24 +22,159 @@
 
 // My headers
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/utility/small_string.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 // STD headers
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <stddef.h>
 #include <stdint.h>
 
 
 namespace osm
  {
+  //====================================================
+  //     Tables
+  //====================================================
+
+  // col_table
+  /**
+   * @brief Constant data of the colors, from which the col map is built. Note: "bg" is the prefix of the background color features and "bd" is the one of the bold color features.
+   * 
+   */
+  inline constexpr feat_table_entry col_table[]
+   {
+    //Error variables:
+    { "error", "Inserted color" },
+  
+    //Color variables:
+    { "black", "\033[30m" },
+    { "red", "\033[31m" },
+    { "green", "\033[32m" },
+    { "orange", "\033[33m" }, 
+    { "blue", "\033[34m" },
+    { "purple", "\033[35m" },
+    { "cyan", "\033[36m" },
+    { "gray", "\033[37m" }, 
+    { "dk gray", "\033[90m" },
+    { "lt red", "\033[91m" }, 
+    { "lt green", "\033[92m" },
+    { "yellow", "\033[93m" },
+    { "lt blue", "\033[94m"},
+    { "lt purple", "\033[95m" },
+    { "lt cyan", "\033[96m" },
+    { "white", "\033[97m" },
+  
+    //Background color variables:
+    { "bg black", "\033[40m" },
+    { "bg red", "\033[41m" },
+    { "bg green", "\033[42m" },
+    { "bg orange", "\033[43m" },
+    { "bg cyan", "\033[44m" },
+    { "bg purple", "\033[45m" },
+    { "bg blue", "\033[46m" },
+    { "bg gray", "\033[47m" },
+    { "bg dk gray", "\033[100m"},
+    { "bg lt red", "\033[101m" },
+    { "bg lt green", "\033[102m" },
+    { "bg yellow", "\033[103m" },
+    { "bg lt blue", "\033[104m"},
+    { "bg lt purple", "\033[105m" },
+    { "bg lt cyan", "\033[106m" },
+    { "bg white", "\033[107m" },
+  
+    //Bold color variables:
+    { "bd black", "\033[1;30m"},
+    { "bd red", "\033[1;31m" },
+    { "bd green", "\033[1;32m" },
+    { "bd orange", "\033[1;33m" }, 
+    { "bd blue", "\033[1;34m" },
+    { "bd purple", "\033[1;35m"},
+    { "bd cyan", "\033[1;36m" },
+    { "bd gray", "\033[1;37m" }
+   };
+
+  // sty_table
+  /**
+   * @brief Constant data of the styles, from which the sty map is built.
+   * 
+   */
+  inline constexpr feat_table_entry sty_table[]
+   {
+    //Error variables:
+    { "error", "Inserted style" },
+  
+    //Style variables:
+    { "bold", "\033[1m" },
+    { "faint", "\033[2m" },
+    { "italics", "\033[3m" },
+    { "underlined", "\033[4m" }, 
+    { "blink", "\033[5m" },
+    { "inverse", "\033[7m" },
+    { "invisible", "\033[8m" },
+    { "crossed", "\033[9m" },
+    { "d-underlined", "\033[21m" }
+   };
+ 
+  // rst_table
+  /**
+   * @brief Constant data of the reset features commands, from which the rst map is built.
+   * 
+   */
+  inline constexpr feat_table_entry rst_table[]
+   {
+    //Error variables:
+    { "error", "Inserted reset command" },
+  
+    //Reset total variables:
+    { "all", "\033[0m" },
+  
+    //Reset color variables:
+    { "color", "\033[39m" },
+    { "bg color", "\033[49m" },
+    { "bd color", "\033[22m \033[39m" },
+  
+    //Reset style variables:
+    { "bd/ft", "\033[22m" },
+    { "italics", "\033[23m" },
+    { "underlined", "\033[24m" },
+    { "blink", "\033[25m" }, 
+    { "inverse", "\033[27m" },
+    { "invisible", "\033[28m" },
+    { "crossed", "\033[29m" },
+   };
+
   //====================================================
   //     Variables
   //====================================================
-  extern const std::unordered_map <std::string, std::string> col, sty, rst;
+  extern const feature_map col, sty, rst;
+
+  //====================================================
+  //     Constants
+  //====================================================
+  inline constexpr size_t SGR_COLOR_MAX_SIZE = 24;      /// Buffer size large enough for any sequence written by rgb_fg / rgb_bg
 
   //====================================================
   //     Functions
   //====================================================
   extern const std::string RGB( int32_t r, int32_t g, int32_t b );
+
+  // Palette conversions
+  extern uint8_t rgb_to_256( uint8_t r, uint8_t g, uint8_t b );
+  extern uint8_t rgb_to_16( uint8_t r, uint8_t g, uint8_t b );
+  extern Color to_rgb( const Color& color );
+
+  // Buffer writers: "out" must have room for SGR_COLOR_MAX_SIZE characters, the returned pointer is one past the last written one.
+  extern char* rgb_fg( char* out, uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth = color_depth() );
+  extern char* rgb_bg( char* out, uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth = color_depth() );
+
+  // Convenience forms
+  extern esc_string rgb_fg( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth = color_depth() );
+  extern esc_string rgb_bg( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth = color_depth() );
  }
 
 #endif
\ No newline at end of file
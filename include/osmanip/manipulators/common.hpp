@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_COMMON_HPP
 #define OSMANIP_COMMON_HPP
@@ -20,15 +21,94 @@
 //====================================================
 
 //STD headers
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <utility>
+#include <stddef.h>
 
 namespace osm
  {  
+  //====================================================
+  //     Aliases
+  //====================================================
+  using feat_table_entry = std::pair<std::string_view, std::string_view>;      /// Entry of the constant table of a features map
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // FeatureMap
+  /**
+   * @brief Features map built from its constant table the first time it is used, so that it has no static initialization cost. It can be used as the map it wraps. The map is never freed, so that it can still be used while static objects are destroyed.
+   *
+   */
+  template <typename Map, typename Entry>
+  class FeatureMap
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     template <size_t N>
+     constexpr FeatureMap( const Entry ( &table )[ N ] ): table_( table ), size_( N ), map_( nullptr ) {}
+
+     FeatureMap( const FeatureMap& ) = delete;
+     FeatureMap& operator = ( const FeatureMap& ) = delete;
+
+     //====================================================
+     //     Getters
+     //====================================================
+     const Map& map() const
+      {
+       if( const Map* map = map_.load( std::memory_order_acquire ) ) return *map;
+
+       // Threads racing on the first use build their own map, only one of them is kept
+       Map* built = new Map( table_, table_ + size_ );
+       Map* expected = nullptr;
+       if( map_.compare_exchange_strong( expected, built, std::memory_order_acq_rel, std::memory_order_acquire ) ) return *built;
+       delete built;
+       return *expected;
+      }
+
+     operator const Map& () const { return map(); }
+
+     //====================================================
+     //     Map interface
+     //====================================================
+     auto find( const std::string& key ) const { return map().find( key ); }
+     const auto& at( const std::string& key ) const { return map().at( key ); }
+     auto count( const std::string& key ) const { return map().count( key ); }
+     auto begin() const { return map().begin(); }
+     auto end() const { return map().end(); }
+     size_t size() const { return size_; }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     const Entry* table_;
+     size_t size_;
+     mutable std::atomic<Map*> map_;
+   };
+
+  using feature_map = FeatureMap<std::unordered_map <std::string, std::string>, feat_table_entry>;
+
   //====================================================
   //     Functions
   //====================================================
+#ifdef OSMANIP_DISABLE_OUTPUT
+  inline const std::string& feat( const std::unordered_map <std::string, std::string>&, const std::string& )
+   {
+    static const std::string empty_feat;
+    return empty_feat;
+   }
+#else
   extern const std::string& feat( const std::unordered_map <std::string, std::string>& generic_map, const std::string& feat_string );
+#endif
  }
 
 #endif
\ No newline at end of file
@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_CURSOR_HPP
 #define OSMANIP_CURSOR_HPP
@@ -21,11 +22,15 @@
 
 // My headers
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/utility/small_string.hpp>
 
 // STD headers
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <stddef.h>
 #include <stdint.h>
 
 namespace osm
@@ -34,18 +39,110 @@ namespace osm
   //     Aliases
   //====================================================
   using string_pair_map = std::unordered_map <std::string, std::pair<std::string, std::string>>;
+  using feat_pair_table_entry = std::pair<std::string_view, std::pair<std::string_view, std::string_view>>;
+  using pair_feature_map = FeatureMap<string_pair_map, feat_pair_table_entry>;
+
+  //====================================================
+  //     Tables
+  //====================================================
+
+  // crs_table
+  /**
+   * @brief Constant data of the cursor commands, from which the crs map is built.
+   * 
+   */
+  inline constexpr feat_pair_table_entry crs_table[]
+   {
+    //Error variables:
+    { "error", { "Inserted cursor command", "" } },
+  
+    //Cursor variables:
+    { "up", { "\033[", "A" } },
+    { "down", { "\033[", "B" } }, 
+    { "right", { "\033[", "C" } },
+    { "left", { "\033[", "D" } }
+   };
+
+  // tcs_table
+  /**
+   * @brief Constant data of the terminal control sequences, from which the tcs map is built.
+   * 
+   */
+  inline constexpr feat_table_entry tcs_table[]
+   {
+    //Error variables:
+    { "error", "Inserted terminal control sequence" },
+
+    //Control characters variables:
+    { "bell", "\x07" },     //Bell sound
+    { "bksp", "\x08" },     //Backspace
+    { "tab", "\x09" },      //Tab
+    { "lfd", "\x0A" },      //Line feed
+    { "ffd", "\x0C" },      //Form feed
+    { "crt", "\x0D" },      //Carriage return
+
+    //Control sequences variables:
+    { "hcrs", "\033[?25l" },      //Hide cursor
+    { "scrs", "\033[?25h" }       //Show cursor
+   };
+
+  // tcsc_table
+  /**
+   * @brief Constant data of the terminal control sequences for clear line / screen, from which the tcsc map is built.
+   * 
+   */
+  inline constexpr feat_pair_table_entry tcsc_table[]
+   {
+    //Error variables:
+    { "error", { "Inserted terminal control sequence", "" } },
+
+    //Control sequences variables:
+    { "csc", { "\033[", "J" } },  //Clear screen (0,1,2)
+    { "cln", { "\033[", "K" } }  //Clear line (0,1,2)
+   };
 
   //====================================================
   //     Variables
   //====================================================
-  extern const std::unordered_map <std::string, std::string> tcs;
-  extern const string_pair_map crs, tcsc;
+  extern const feature_map tcs;
+  extern const pair_feature_map crs, tcsc;
+
+  //====================================================
+  //     Constants
+  //====================================================
+  inline constexpr size_t CSI_MAX_SIZE = 32;      /// Buffer size large enough for any sequence written by the functions below
 
   //====================================================
   //     Functions
   //====================================================
   extern const std::string feat( const string_pair_map& generic_map, const std::string& feat_string, int32_t feat_int );
   extern const std::string go_to( int32_t x, int32_t y );
+
+  // Buffer writers: "out" must have room for CSI_MAX_SIZE characters, the returned pointer is one past the last written one.
+  extern char* cursor_up( char* out, int32_t n );
+  extern char* cursor_down( char* out, int32_t n );
+  extern char* cursor_right( char* out, int32_t n );
+  extern char* cursor_left( char* out, int32_t n );
+  extern char* cursor_to( char* out, int32_t x, int32_t y );
+  extern char* clear_line( char* out, int32_t mode );
+  extern char* clear_screen( char* out, int32_t mode );
+
+  // Stream writers and convenience forms, which emit nothing when escapes are disabled
+  extern std::ostream& cursor_up( std::ostream& os, int32_t n );
+  extern std::ostream& cursor_down( std::ostream& os, int32_t n );
+  extern std::ostream& cursor_right( std::ostream& os, int32_t n );
+  extern std::ostream& cursor_left( std::ostream& os, int32_t n );
+  extern std::ostream& cursor_to( std::ostream& os, int32_t x, int32_t y );
+  extern std::ostream& clear_line( std::ostream& os, int32_t mode = 0 );
+  extern std::ostream& clear_screen( std::ostream& os, int32_t mode = 0 );
+
+  extern esc_string cursor_up( int32_t n );
+  extern esc_string cursor_down( int32_t n );
+  extern esc_string cursor_right( int32_t n );
+  extern esc_string cursor_left( int32_t n );
+  extern esc_string cursor_to( int32_t x, int32_t y );
+  extern esc_string clear_line( int32_t mode = 0 );
+  extern esc_string clear_screen( int32_t mode = 0 );
  }
 
 #endif
\ No newline at end of file
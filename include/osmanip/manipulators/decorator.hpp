@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_DECORATOR_HPP
 #define OSMANIP_DECORATOR_HPP
@@ -22,26 +23,34 @@
 //My headers
 #include <osmanip/manipulators/common.hpp>
 #include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
 #include <osmanip/utility/iostream.hpp>
-
-//Extra headers
-#include <arsenalgear/utils.hpp>
+#include <osmanip/utility/small_string.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 //STD headers
-#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <ostream>
 #include <string>
 #include <unordered_map>
+#include <vector>
+#include <stdint.h>
 
 namespace osm
  {
   //====================================================
   //     Classes
   //====================================================
-
   // Decorator
   /**
    * @brief Class used to decorate an output stream. Each setting is set permanently on the chosen output stream until the destructor is met or one of the reset functions is called.
    * 
+   * @details The settings are kept in the StreamStyle of each stream, so that an insertion finds them in O(1) without any lock, and threads decorating different streams never share them. The stream selected by the call operator is kept per thread, so that threads using the same Decorator don't interfere.
+   * 
    */
   class Decorator
    {
@@ -51,13 +60,17 @@ namespace osm
      //     Constructors and destructors
      //====================================================
      Decorator();
+     Decorator( const Decorator& other );
      ~Decorator();
+
+     Decorator& operator = ( const Decorator& other );
  
      //====================================================
      //     Setters
      //====================================================
      void setColor( const std::string& color, std::ostream& os = osm::cout );
      void setStyle( const std::string& style, std::ostream& os = osm::cout );
+     void setStyle( StyleHandle style, std::ostream& os = osm::cout );
  
      //====================================================
      //     Resetters
@@ -72,9 +85,11 @@ namespace osm
      //====================================================
      std::string getColor( std::ostream& os = osm::cout );
      std::string getStyle( std::ostream& os = osm::cout );
+     StyleHandle getStyleHandle( std::ostream& os = osm::cout ) const;
      std::unordered_map <std::ostream*, std::string> getColorList();
      std::unordered_map <std::ostream*, std::string> getStyleList();
-     std::ostream& getCurrentStream();
+     std::ostream& getCurrentStream() const;
+     const esc_string& getPrefix( std::ostream& os = osm::cout ) const;
 
      //====================================================
      //     Operators
@@ -83,42 +98,78 @@ namespace osm
 
     private:
 
+     //====================================================
+     //     Private structs
+     //====================================================
+
+     // Tracked
+     /**
+      * @brief Stream decorated by the Decorator, which is only accessed while it exists.
+      * 
+      */
+     struct Tracked
+      {
+       std::ostream* stream;
+       std::weak_ptr<void> alive;
+      };
+
+     //====================================================
+     //     Private methods
+     //====================================================
+     DecoratorStyle* find( std::ostream& os ) const;
+     DecoratorStyle& settings( std::ostream& os );
+     void updatePrefix( std::ostream& os );
+     void copySettings( const Decorator& other );
+     void clearSettings();
+
      //====================================================
      //     Attributes
      //====================================================
-     std::unordered_map <std::ostream*, std::string> colors, styles;
-     std::ostream* current_stream;
+     uint64_t id;
+     std::vector<Tracked> streams;
+     mutable std::mutex streams_mutex;
+     std::atomic<std::ostream*> current_stream;
    };
 
   //====================================================
   //     Operator << 
   //====================================================
+
+  // decorate
   /**
-   * @brief Operator overload to output a modified ostream object which properties are set thanks to the Decorator class.
+   * @brief Writes an element into a stream with the precompiled prefix of the Decorator for that stream, without copying nor allocating anything.
    * 
-   * @tparam T The template parameter of the object sent into the output stream.
-   * @param my_shell The Decorator object.
-   * @param elem The element sent into the output stream.
-   * @return std::ostream& The modified output stream.
    */
   template <typename T>
-  std::ostream& operator << ( Decorator my_shell, const T& elem )
+  std::ostream& decorate( const Decorator& my_shell, std::ostream& os, const T& elem )
    {
-    if ( my_shell.getColor( my_shell.getCurrentStream() ) != "" )
+    if constexpr( ! OUTPUT_ENABLED )
      {
-      my_shell.getCurrentStream() << feat( col, my_shell.getColor( my_shell.getCurrentStream() ) );
+      return os << elem;
      }
-    if ( my_shell.getStyle( my_shell.getCurrentStream() ) != "" )
+
+    const esc_string& prefix = my_shell.getPrefix( os );
+
+    if ( prefix.empty() || ! colors_enabled() )
      {
-      std::vector<std::string> list_of_styles = agr::split_string( my_shell.getStyle( my_shell.getCurrentStream() ), " " );
-      for ( auto elem: list_of_styles )
-       {
-        my_shell.getCurrentStream() << feat( sty, elem );
-       }
+      return os << elem;
      }
-    my_shell.getCurrentStream() << elem << feat( rst, "all" );
-    
-    return my_shell.getCurrentStream();
+
+    return os << prefix << elem << SGR_RESET;
+   }
+
+  /**
+   * @brief Operator overload to output a modified ostream object which properties are set thanks to the Decorator class. The element is sent into the last stream selected with the call operator of the Decorator by the calling thread.
+   * 
+   * @tparam T The template parameter of the object sent into the output stream.
+   * @param my_shell The Decorator object.
+   * @param elem The element sent into the output stream.
+   * @return std::ostream& The modified output stream.
+   */
+  template <typename T>
+  std::ostream& operator << ( const Decorator& my_shell, const T& elem )
+   {
+    return decorate( my_shell, my_shell.getCurrentStream(), elem );
    }
  }
 
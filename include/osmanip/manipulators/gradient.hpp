@@ -0,0 +1,78 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file gradient.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_GRADIENT_HPP
+#define OSMANIP_GRADIENT_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+// STD headers
+#include <initializer_list>
+#include <vector>
+#include <stddef.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // Gradient
+  /**
+   * @brief Color gradient through a list of evenly spaced RGB stops, sampled into a lookup table of interned styles when it is built. Colors are converted to the given color depth once, so drawing a gradient costs the same as drawing a solid color.
+   *
+   */
+  class Gradient
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     Gradient() = default;
+     Gradient( std::initializer_list<Color> stops, size_t steps, bool background = false, COLORDEPTH depth = color_depth() );
+     Gradient( const std::vector<Color>& stops, size_t steps, bool background = false, COLORDEPTH depth = color_depth() );
+
+     //====================================================
+     //     Getters
+     //====================================================
+     StyleHandle at( size_t index ) const { return table_[ index ]; }
+     StyleHandle sample( size_t index, size_t count ) const;
+     StyleHandle sample( double fraction ) const;
+     size_t size() const { return table_.size(); }
+     bool empty() const { return table_.empty(); }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     std::vector<StyleHandle> table_;
+   };
+
+  //====================================================
+  //     Functions
+  //====================================================
+  extern Color color_at_depth( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth = color_depth() );
+ }
+
+#endif
@@ -0,0 +1,471 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file printer.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_PRINTER_HPP
+#define OSMANIP_PRINTER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/styled.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+// STD headers
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // FormatSpec
+  /**
+   * @brief Format specification of a replacement field: [[fill]align][sign][0][width][.precision][type], with the same meaning as in std::format. Supported types are d, x, X, o, b, c for integers, f, F, e, E, g, G for floating points and s for strings.
+   *
+   */
+  struct FormatSpec
+   {
+    char fill = ' ';
+    char align = '\0';      /// '<', '>', '^' or '\0' for the default of the type
+    char sign = '-';        /// '+', '-' or ' '
+    bool zero = false;
+    uint16_t width = 0;
+    int16_t precision = -1;
+    char type = '\0';
+   };
+
+  // FormatField
+  /**
+   * @brief Replacement field of a FormatString: where its literal text ends, its SGR prefix and its format specification.
+   *
+   */
+  struct FormatField
+   {
+    size_t text_end = 0;
+    size_t prefix_begin = 0, prefix_end = 0;
+    FormatSpec spec;
+   };
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // FormatString
+  /**
+   * @brief Format string parsed into literal text and replacement fields. Fields are written as {} or {:spec}, where spec is a comma-separated list of colors, styles (names of the col and sty maps) and at most one FormatSpec, e.g. "{:red,bold,>8.2f}". Braces are escaped as {{ and }}. If it is declared constexpr the whole parsing, including the resolution of the SGR sequences, happens at compile time and format errors are compile-time errors.
+   *
+   * @tparam N The size of the format string literal.
+   */
+  template <size_t N>
+  class FormatString
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     constexpr FormatString( const char ( &fmt )[ N ] ):
+      text_(),
+      prefixes_(),
+      fields_{},
+      size_( 0 )
+      {
+       const std::string_view str( fmt, N - 1 );
+       size_t i = 0;
+
+       while( i < str.size() )
+        {
+         const size_t next = str.find_first_of( "{}", i );
+         text_.append( str.substr( i, next == std::string_view::npos ? std::string_view::npos : next - i ) );
+         if( next == std::string_view::npos ) break;
+
+         // Escaped braces
+         if( next + 1 < str.size() && str[ next + 1 ] == str[ next ] )
+          {
+           text_.append( str.substr( next, 1 ) );
+           i = next + 2;
+           continue;
+          }
+
+         if( str[ next ] == '}' ) throw std::invalid_argument( "Unmatched '}' in format string!" );
+
+         const size_t close = str.find( '}', next );
+         if( close == std::string_view::npos ) throw std::invalid_argument( "Unterminated replacement field in format string!" );
+
+         FormatField& field = fields_[ size_++ ];
+         field.text_end = text_.size();
+         field.prefix_begin = prefixes_.size();
+
+         const std::string_view content = str.substr( next + 1, close - next - 1 );
+         if( ! content.empty() )
+          {
+           if( content[ 0 ] != ':' ) throw std::invalid_argument( "Only automatic field numbering is supported in format strings!" );
+           parse_spec( content.substr( 1 ), field );
+          }
+
+         field.prefix_end = prefixes_.size();
+         i = close + 1;
+        }
+      }
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr size_t fields() const { return size_; }
+     constexpr const FormatField& field( size_t i ) const { return fields_[ i ]; }
+     constexpr std::string_view text() const { return text_.view(); }
+     constexpr std::string_view prefix( size_t i ) const { return prefixes_.view().substr( fields_[ i ].prefix_begin, fields_[ i ].prefix_end - fields_[ i ].prefix_begin ); }
+
+    private:
+
+     //====================================================
+     //     Private methods
+     //====================================================
+
+     // parse_spec
+     /**
+      * @brief Parses the content of a replacement field after the ':'.
+      *
+      */
+     constexpr void parse_spec( std::string_view spec, FormatField& field )
+      {
+       bool has_format = false;
+
+       while( ! spec.empty() )
+        {
+         const size_t comma = spec.find( ',' );
+         std::string_view item = spec.substr( 0, comma );
+         spec = ( comma == std::string_view::npos ) ? std::string_view() : spec.substr( comma + 1 );
+
+         while( ! item.empty() && item.front() == ' ' ) item.remove_prefix( 1 );
+         while( ! item.empty() && item.back() == ' ' ) item.remove_suffix( 1 );
+         if( item.empty() ) continue;
+
+         if( is_format( item ) )
+          {
+           if( has_format ) throw std::invalid_argument( "Only one format specification is allowed per replacement field!" );
+           field.spec = parse_format( item );
+           has_format = true;
+          }
+         else
+          {
+           const std::string_view sequence = find_feature( item );
+           prefixes_.append( field.prefix_begin == prefixes_.size() ? "\033[" : ";" ).append( sequence.substr( 2, sequence.size() - 3 ) );
+          }
+        }
+
+       if( field.prefix_begin != prefixes_.size() ) prefixes_.append( "m" );
+      }
+
+     // is_type
+     static constexpr bool is_type( char c )
+      {
+       return std::string_view( "dxXobcfFeEgGs" ).find( c ) != std::string_view::npos;
+      }
+
+     // is_align
+     static constexpr bool is_align( char c )
+      {
+       return c == '<' || c == '>' || c == '^';
+      }
+
+     // is_format
+     /**
+      * @brief Tells a FormatSpec apart from a color or style name.
+      *
+      */
+     static constexpr bool is_format( std::string_view item )
+      {
+       return std::string_view( "<>^+- 0123456789." ).find( item[ 0 ] ) != std::string_view::npos ||
+              ( item.size() == 1 && is_type( item[ 0 ] ) ) ||
+              ( item.size() > 1 && is_align( item[ 1 ] ) );
+      }
+
+     // parse_format
+     static constexpr FormatSpec parse_format( std::string_view item )
+      {
+       FormatSpec spec;
+       size_t i = 0;
+
+       if( item.size() > 1 && is_align( item[ 1 ] ) )
+        {
+         spec.fill = item[ 0 ];
+         spec.align = item[ 1 ];
+         i = 2;
+        }
+       else if( is_align( item[ 0 ] ) )
+        {
+         spec.align = item[ 0 ];
+         i = 1;
+        }
+
+       if( i < item.size() && ( item[ i ] == '+' || item[ i ] == '-' || item[ i ] == ' ' ) ) spec.sign = item[ i++ ];
+       if( i < item.size() && item[ i ] == '0' )
+        {
+         spec.zero = true;
+         i++;
+        }
+
+       while( i < item.size() && item[ i ] >= '0' && item[ i ] <= '9' ) spec.width = static_cast<uint16_t>( spec.width * 10 + ( item[ i++ ] - '0' ) );
+
+       if( i < item.size() && item[ i ] == '.' )
+        {
+         spec.precision = 0;
+         for( i++; i < item.size() && item[ i ] >= '0' && item[ i ] <= '9'; i++ ) spec.precision = static_cast<int16_t>( spec.precision * 10 + ( item[ i ] - '0' ) );
+        }
+
+       if( i < item.size() && is_type( item[ i ] ) ) spec.type = item[ i++ ];
+       if( i != item.size() ) throw std::invalid_argument( "Invalid format specification!" );
+
+       return spec;
+      }
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     FixedString<N> text_, prefixes_;
+     FormatField fields_[ N / 2 + 1 ];
+     size_t size_;
+   };
+
+  // ConstantFormat
+  /**
+   * @brief Format string parsed at compile time, created by OSMANIP_FORMAT. Its type carries the FormatString, so that print checks the number of arguments at compile time too.
+   *
+   * @tparam Source A type whose static parse() method returns the FormatString.
+   */
+  template <typename Source>
+  struct ConstantFormat
+   {
+    static constexpr auto value = Source::parse();
+   };
+
+  /**
+   * @brief Format string literal parsed at compile time, to be passed to print. Example: osm::print( OSMANIP_FORMAT( "{:red,bold} took {:.2f}s\n" ), name, t );
+   *
+   */
+#define OSMANIP_FORMAT( fmt ) \
+  ( [] { struct Source { static constexpr auto parse() { return ::osm::FormatString<sizeof( fmt )>( fmt ); } }; return ::osm::ConstantFormat<Source>{}; }() )
+
+#if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+
+  // FormatLiteral
+  /**
+   * @brief Format string literal usable as a template argument of print, which is always parsed at compile time.
+   *
+   */
+  template <size_t N>
+  struct FormatLiteral
+   {
+    char value[ N ];
+
+    consteval FormatLiteral( const char ( &str )[ N ] ): value{}
+     {
+      for( size_t i = 0; i < N; i++ ) value[ i ] = str[ i ];
+     }
+   };
+
+#endif
+
+  // PrintBuffer
+  /**
+   * @brief Per-thread buffer in which print formats its output, so that the steady state does not allocate. Nested uses (e.g. print called from an operator << used by print) get their own buffer.
+   *
+   */
+  class PrintBuffer
+   {
+    public:
+
+     //====================================================
+     //     Constructors and destructors
+     //====================================================
+     PrintBuffer();
+     ~PrintBuffer();
+
+     PrintBuffer( const PrintBuffer& ) = delete;
+     PrintBuffer& operator = ( const PrintBuffer& ) = delete;
+
+     //====================================================
+     //     Getters
+     //====================================================
+     std::string& str() { return *str_; }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     std::string* str_;
+     std::string local_;
+   };
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // Values formatting, appended to "out"
+  extern void format_value( std::string& out, int64_t value, const FormatSpec& spec );
+  extern void format_value( std::string& out, uint64_t value, const FormatSpec& spec );
+  extern void format_value( std::string& out, double value, const FormatSpec& spec );
+  extern void format_value( std::string& out, std::string_view value, const FormatSpec& spec );
+  extern void format_value( std::string& out, bool value, const FormatSpec& spec );
+  extern void format_value( std::string& out, char value, const FormatSpec& spec );
+
+  // format_arg
+  /**
+   * @brief Appends an argument of print to the buffer. Types without a dedicated overload of format_value are formatted with their operator <<.
+   *
+   */
+  template <typename T>
+  void format_arg( std::string& out, const T& value, const FormatSpec& spec )
+   {
+    if constexpr( std::is_same_v<T, bool> || std::is_same_v<T, char> ) format_value( out, value, spec );
+    else if constexpr( std::is_integral_v<T> && std::is_signed_v<T> ) format_value( out, static_cast<int64_t>( value ), spec );
+    else if constexpr( std::is_integral_v<T> ) format_value( out, static_cast<uint64_t>( value ), spec );
+    else if constexpr( std::is_floating_point_v<T> ) format_value( out, static_cast<double>( value ), spec );
+    else if constexpr( std::is_enum_v<T> ) format_arg( out, static_cast<std::underlying_type_t<T>>( value ), spec );
+    else if constexpr( std::is_convertible_v<const T&, std::string_view> ) format_value( out, std::string_view( value ), spec );
+    else
+     {
+      std::ostringstream oss;
+      oss << value;
+      format_value( out, std::string_view( oss.str() ), spec );
+     }
+   }
+
+  // print
+  /**
+   * @brief Formats the arguments into a single buffer, together with the SGR sequences of the fields (only if colors are enabled), then writes it into the stream and flushes once. Example: osm::print( "{:red,bold} took {:.2f}s\n", name, t );
+   *
+   * @param os The output stream.
+   * @param fmt The format string.
+   * @param args The arguments, one per replacement field.
+   * @return std::ostream& The output stream.
+   */
+  template <size_t N, typename... Args>
+  std::ostream& print( std::ostream& os, const FormatString<N>& fmt, const Args&... args )
+   {
+    if( fmt.fields() != sizeof...( Args ) )
+     {
+      throw std::invalid_argument( "The number of arguments does not match the replacement fields of the format string!" );
+     }
+
+    PrintBuffer buffer;
+    std::string& out = buffer.str();
+    const std::string_view text = fmt.text();
+    const bool colors = colors_enabled();
+
+    size_t i = 0, text_begin = 0;
+    const auto& field = [ & ]( const auto& arg )
+     {
+      const FormatField& f = fmt.field( i );
+      out.append( text.data() + text_begin, f.text_end - text_begin );
+      text_begin = f.text_end;
+
+      const std::string_view prefix = fmt.prefix( i++ );
+      if( colors ) out.append( prefix );
+      format_arg( out, arg, f.spec );
+      if( colors && ! prefix.empty() ) out.append( STYLED_RESET );
+     };
+
+    ( field( args ), ... );
+    out.append( text.data() + text_begin, text.size() - text_begin );
+
+    os.write( out.data(), static_cast<std::streamsize>( out.size() ) );
+    return os.flush();
+   }
+
+  template <size_t N, typename... Args>
+  std::ostream& print( const FormatString<N>& fmt, const Args&... args )
+   {
+    return print( osm::cout, fmt, args... );
+   }
+
+  /**
+   * @brief Same as above, with the format string parsed at runtime at each call. Prefer a constexpr FormatString, OSMANIP_FORMAT or, in C++20, the format string as template argument, which are parsed at compile time.
+   *
+   */
+  template <size_t N, typename... Args>
+  std::ostream& print( std::ostream& os, const char ( &fmt )[ N ], const Args&... args )
+   {
+    return print( os, FormatString<N>( fmt ), args... );
+   }
+
+  template <size_t N, typename... Args>
+  std::ostream& print( const char ( &fmt )[ N ], const Args&... args )
+   {
+    return print( osm::cout, FormatString<N>( fmt ), args... );
+   }
+
+  /**
+   * @brief Same as above, with the format string created by OSMANIP_FORMAT: it is parsed at compile time and a wrong number of arguments is a compile-time error.
+   *
+   */
+  template <typename Source, typename... Args>
+  std::ostream& print( std::ostream& os, ConstantFormat<Source>, const Args&... args )
+   {
+    constexpr const auto& fmt = ConstantFormat<Source>::value;
+    static_assert( fmt.fields() == sizeof...( Args ), "The number of arguments does not match the replacement fields of the format string!" );
+    return print( os, fmt, args... );
+   }
+
+  template <typename Source, typename... Args>
+  std::ostream& print( ConstantFormat<Source> fmt, const Args&... args )
+   {
+    return print( osm::cout, fmt, args... );
+   }
+
+#if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+
+  /**
+   * @brief Same as above, with the format string literal as template argument: it is parsed at compile time and a wrong number of arguments is a compile-time error. Example: osm::print<"{:red,bold} took {:.2f}s\n">( name, t );
+   *
+   */
+  template <FormatLiteral fmt, typename... Args>
+  std::ostream& print( std::ostream& os, const Args&... args )
+   {
+    static constexpr FormatString<sizeof( fmt.value )> parsed( fmt.value );
+    static_assert( parsed.fields() == sizeof...( Args ), "The number of arguments does not match the replacement fields of the format string!" );
+    return print( os, parsed, args... );
+   }
+
+  template <FormatLiteral fmt, typename First, typename... Args>
+    requires ( ! std::is_base_of_v<std::ostream, First> )
+  std::ostream& print( const First& first, const Args&... args )
+   {
+    return print<fmt>( osm::cout, first, args... );
+   }
+
+  template <FormatLiteral fmt>
+  std::ostream& print()
+   {
+    return print<fmt>( osm::cout );
+   }
+
+#endif
+ }
+
+#endif
@@ -0,0 +1,244 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file sgr.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_SGR_HPP
+#define OSMANIP_SGR_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/small_string.hpp>
+
+// STD headers
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Enum classes
+  //====================================================
+
+  // ATTR
+  /**
+   * @brief Bit set of the SGR text attributes. Values can be combined with the | operator.
+   *
+   */
+  enum class ATTR : uint16_t
+   {
+    NONE = 0,
+    BOLD = 1 << 0,
+    FAINT = 1 << 1,
+    ITALICS = 1 << 2,
+    UNDERLINED = 1 << 3,
+    BLINK = 1 << 4,
+    INVERSE = 1 << 5,
+    INVISIBLE = 1 << 6,
+    CROSSED = 1 << 7,
+    D_UNDERLINED = 1 << 8
+   };
+
+  constexpr ATTR operator | ( ATTR lhs, ATTR rhs ) { return static_cast<ATTR>( static_cast<uint16_t>( lhs ) | static_cast<uint16_t>( rhs ) ); }
+  constexpr ATTR operator & ( ATTR lhs, ATTR rhs ) { return static_cast<ATTR>( static_cast<uint16_t>( lhs ) & static_cast<uint16_t>( rhs ) ); }
+  constexpr ATTR operator ~ ( ATTR attr ) { return static_cast<ATTR>( ~static_cast<uint16_t>( attr ) & 0x1FF ); }
+  constexpr bool any( ATTR attr ) { return attr != ATTR::NONE; }
+
+  // COLORTYPE
+  /**
+   * @brief Encoding of a Color: DEFAULT is the terminal default, BASIC one of the 16 basic colors, INDEXED one of the xterm-256 palette and RGB a 24-bit color.
+   *
+   */
+  enum class COLORTYPE : uint8_t { DEFAULT, BASIC, INDEXED, RGB };
+
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // Color
+  /**
+   * @brief Foreground or background color of a Style. For BASIC and INDEXED colors the palette index is stored in "r".
+   *
+   */
+  struct Color
+   {
+    COLORTYPE type = COLORTYPE::DEFAULT;
+    uint8_t r = 0, g = 0, b = 0;
+
+    static constexpr Color basic( uint8_t index ) { return { COLORTYPE::BASIC, index, 0, 0 }; }
+    static constexpr Color indexed( uint8_t index ) { return { COLORTYPE::INDEXED, index, 0, 0 }; }
+    static constexpr Color rgb( uint8_t r, uint8_t g, uint8_t b ) { return { COLORTYPE::RGB, r, g, b }; }
+   };
+
+  constexpr bool operator == ( const Color& lhs, const Color& rhs ) { return lhs.type == rhs.type && lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b; }
+  constexpr bool operator != ( const Color& lhs, const Color& rhs ) { return ! ( lhs == rhs ); }
+
+  // Style
+  /**
+   * @brief Complete set of the SGR attributes of the text: foreground, background and text attributes. A default-constructed Style is the terminal default.
+   *
+   */
+  struct Style
+   {
+    Color fg, bg;
+    ATTR attrs = ATTR::NONE;
+
+    constexpr bool isDefault() const { return fg.type == COLORTYPE::DEFAULT && bg.type == COLORTYPE::DEFAULT && attrs == ATTR::NONE; }
+   };
+
+  constexpr bool operator == ( const Style& lhs, const Style& rhs ) { return lhs.fg == rhs.fg && lhs.bg == rhs.bg && lhs.attrs == rhs.attrs; }
+  constexpr bool operator != ( const Style& lhs, const Style& rhs ) { return ! ( lhs == rhs ); }
+
+  // operator |
+  /**
+   * @brief Combines two styles: colors set in the right one override those of the left one, attributes are merged.
+   *
+   */
+  constexpr Style operator | ( const Style& lhs, const Style& rhs )
+   {
+    return { rhs.fg.type != COLORTYPE::DEFAULT ? rhs.fg : lhs.fg, rhs.bg.type != COLORTYPE::DEFAULT ? rhs.bg : lhs.bg, lhs.attrs | rhs.attrs };
+   }
+
+  //====================================================
+  //     Style constants
+  //====================================================
+
+  // styles
+  /**
+   * @brief Ready-made styles, which can be combined with the | operator (e.g. styles::red | styles::bold).
+   *
+   */
+  namespace styles
+   {
+    // Colors
+    inline constexpr Style black { Color::basic( 0 ), {}, ATTR::NONE };
+    inline constexpr Style red { Color::basic( 1 ), {}, ATTR::NONE };
+    inline constexpr Style green { Color::basic( 2 ), {}, ATTR::NONE };
+    inline constexpr Style orange { Color::basic( 3 ), {}, ATTR::NONE };
+    inline constexpr Style blue { Color::basic( 4 ), {}, ATTR::NONE };
+    inline constexpr Style purple { Color::basic( 5 ), {}, ATTR::NONE };
+    inline constexpr Style cyan { Color::basic( 6 ), {}, ATTR::NONE };
+    inline constexpr Style gray { Color::basic( 7 ), {}, ATTR::NONE };
+    inline constexpr Style dk_gray { Color::basic( 8 ), {}, ATTR::NONE };
+    inline constexpr Style lt_red { Color::basic( 9 ), {}, ATTR::NONE };
+    inline constexpr Style lt_green { Color::basic( 10 ), {}, ATTR::NONE };
+    inline constexpr Style yellow { Color::basic( 11 ), {}, ATTR::NONE };
+    inline constexpr Style lt_blue { Color::basic( 12 ), {}, ATTR::NONE };
+    inline constexpr Style lt_purple { Color::basic( 13 ), {}, ATTR::NONE };
+    inline constexpr Style lt_cyan { Color::basic( 14 ), {}, ATTR::NONE };
+    inline constexpr Style white { Color::basic( 15 ), {}, ATTR::NONE };
+
+    // Background colors
+    inline constexpr Style bg_black { {}, Color::basic( 0 ), ATTR::NONE };
+    inline constexpr Style bg_red { {}, Color::basic( 1 ), ATTR::NONE };
+    inline constexpr Style bg_green { {}, Color::basic( 2 ), ATTR::NONE };
+    inline constexpr Style bg_orange { {}, Color::basic( 3 ), ATTR::NONE };
+    inline constexpr Style bg_blue { {}, Color::basic( 4 ), ATTR::NONE };
+    inline constexpr Style bg_purple { {}, Color::basic( 5 ), ATTR::NONE };
+    inline constexpr Style bg_cyan { {}, Color::basic( 6 ), ATTR::NONE };
+    inline constexpr Style bg_gray { {}, Color::basic( 7 ), ATTR::NONE };
+    inline constexpr Style bg_white { {}, Color::basic( 15 ), ATTR::NONE };
+
+    // Attributes
+    inline constexpr Style bold { {}, {}, ATTR::BOLD };
+    inline constexpr Style faint { {}, {}, ATTR::FAINT };
+    inline constexpr Style italics { {}, {}, ATTR::ITALICS };
+    inline constexpr Style underlined { {}, {}, ATTR::UNDERLINED };
+    inline constexpr Style blink { {}, {}, ATTR::BLINK };
+    inline constexpr Style inverse { {}, {}, ATTR::INVERSE };
+    inline constexpr Style invisible { {}, {}, ATTR::INVISIBLE };
+    inline constexpr Style crossed { {}, {}, ATTR::CROSSED };
+    inline constexpr Style d_underlined { {}, {}, ATTR::D_UNDERLINED };
+   }
+
+  //====================================================
+  //     Constants
+  //====================================================
+  inline constexpr size_t SGR_MAX_SIZE = 64;      /// Buffer size large enough for any sequence written by write_sgr
+  inline constexpr std::string_view SGR_RESET = "\033[0m";
+
+  //====================================================
+  //     Functions
+  //====================================================
+  extern void apply_sgr( Style& style, const uint32_t* params, size_t size, uint32_t subparams = 0 );
+  extern Style parse_sgr( std::string_view sequences, Style base = {} );
+  extern std::string strip_sgr( std::string_view sequences );
+
+  // Buffer writer: "out" must have room for SGR_MAX_SIZE characters, the returned pointer is one past the last written one.
+  extern char* write_sgr( char* out, const Style& from, const Style& to, bool full_reset = true );
+  extern esc_string sgr( const Style& from, const Style& to );
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // SgrState
+  /**
+   * @brief Tracks the SGR state of an output stream, so that moving to a new Style emits only the attributes which differ, combined in a single sequence. The state assumes it is the only one emitting SGR sequences into the stream, unless it is created by over().
+   *
+   */
+  class SgrState
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     constexpr SgrState( const Style& current = {} ): current_( current ), base_(), full_reset_( true ) {}
+
+     // over
+     /**
+      * @brief Creates a state whose styles are layered over the given base style, e.g. the current style of the stream, and whose reset goes back to it. It never emits a whole reset, so that the attributes set by the caller are kept even if they are not part of the base.
+      *
+      */
+     static constexpr SgrState over( const Style& base )
+      {
+       SgrState state( base );
+       state.base_ = base;
+       state.full_reset_ = false;
+       return state;
+      }
+
+     //====================================================
+     //     Methods
+     //====================================================
+     char* apply( char* out, const Style& style );
+     esc_string apply( const Style& style );
+     std::ostream& apply( std::ostream& os, const Style& style );
+
+     esc_string reset() { return apply( Style{} ); }
+     std::ostream& reset( std::ostream& os ) { return apply( os, Style{} ); }
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr const Style& current() const { return current_; }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     Style current_;
+     Style base_;
+     bool full_reset_;
+   };
+ }
+
+#endif
@@ -0,0 +1,163 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stream_style.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_STREAM_STYLE_HPP
+#define OSMANIP_STREAM_STYLE_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/utility/small_string.hpp>
+
+// STD headers
+#include <ios>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // DecoratorStyle
+  /**
+   * @brief Settings of a Decorator for a stream, kept in the StreamStyle of the stream.
+   *
+   */
+  struct DecoratorStyle
+   {
+    uint64_t owner;             /// Identifier of the Decorator
+    std::string color;          /// Color name
+    std::string styles;         /// Style names, separated by spaces
+    StyleHandle handle;         /// Interned style, combined with the color and the styles
+    esc_string prefix;          /// Combined sequence of the color and the styles
+    bool valid;                 /// False if the color or one of the styles is not supported
+   };
+
+  // StreamStyle
+  /**
+   * @brief Decoration state attached to a stream through its std::ios_base storage. It is created at the first decoration of the stream, deleted together with it and copied by copyfmt, like the other formatting state of the stream. The settings of the Decorator objects are not copied, since they belong to the Decorator.
+   *
+   */
+  struct StreamStyle
+   {
+    SgrState sgr;               /// SGR state emitted into the stream by the manipulators
+    std::vector<Style> stack;   /// Styles to be restored by the open StyleScope objects, the innermost last
+    std::vector<DecoratorStyle> decorators;      /// Settings of the Decorator objects which decorate the stream
+    std::shared_ptr<void> alive;                 /// Created for the first Decorator of the stream, which watches it to know whether the stream still exists
+   };
+
+  // Decor
+  /**
+   * @brief Manipulator returned by osm::decor.
+   *
+   */
+  struct Decor
+   {
+    Style style;
+   };
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // StyleScope
+  /**
+   * @brief Style region of a stream, returned by osm::push_style. At destruction the stream goes back to the style it had when the scope was opened, emitting only the attributes which differ. Scopes are expected to be closed in reverse order: closing an outer scope closes the inner ones too.
+   *
+   */
+  class StyleScope
+   {
+    public:
+
+     //====================================================
+     //     Constructors and destructors
+     //====================================================
+     StyleScope( std::ostream& os, const Style& style );
+     StyleScope( StyleScope&& other ) noexcept;
+     ~StyleScope();
+
+     StyleScope( const StyleScope& ) = delete;
+     StyleScope& operator = ( const StyleScope& ) = delete;
+     StyleScope& operator = ( StyleScope&& ) = delete;
+
+     //====================================================
+     //     Methods
+     //====================================================
+     void pop();
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     std::ostream* os_;
+     size_t depth_;
+   };
+
+  //====================================================
+  //     Functions
+  //====================================================
+  extern StreamStyle& stream_style( std::ios_base& ios );
+  extern StreamStyle* find_stream_style( std::ios_base& ios );
+  extern Style current_style( std::ios_base& ios );
+
+  //====================================================
+  //     Manipulators
+  //====================================================
+
+  // decor
+  /**
+   * @brief Moves the stream to a new style, emitting only the attributes which differ from its current one. The state lives in the stream itself, so the lookup is O(1), no lock is taken and threads using different streams never share anything. Example: os << osm::decor( styles::red | styles::bold ) << "Error" << osm::undecor;
+   *
+   * @param style The new style of the stream.
+   * @return Decor The manipulator.
+   */
+  constexpr Decor decor( const Style& style )
+   {
+    return Decor{ style };
+   }
+
+  inline constexpr Decor undecor {};      /// Moves the stream back to the default style
+
+  // push_style
+  /**
+   * @brief Opens a style region of a stream: the style is added on top of the current one of the stream until the returned scope is destroyed. Example: auto header = osm::push_style( os, styles::bold ); ... { auto count = osm::push_style( os, styles::red ); os << errors; } os << " errors";
+   *
+   * @param os The stream.
+   * @param style The style added to the current one.
+   * @return StyleScope The scope which restores the enclosing style.
+   */
+  inline StyleScope push_style( std::ostream& os, const Style& style )
+   {
+    return StyleScope( os, style );
+   }
+
+  //====================================================
+  //     Operators
+  //====================================================
+  extern std::ostream& operator << ( std::ostream& os, const Decor& decor );
+ }
+
+#endif
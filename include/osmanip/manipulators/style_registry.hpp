@@ -0,0 +1,98 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file style_registry.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_STYLE_REGISTRY_HPP
+#define OSMANIP_STYLE_REGISTRY_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/sgr.hpp>
+
+// STD headers
+#include <ostream>
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Constants
+  //====================================================
+  inline constexpr size_t STYLE_REGISTRY_SIZE = 65536;      /// Maximum number of interned styles, including the default one
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // StyleHandle
+  /**
+   * @brief Handle of a Style interned in the global style registry. Equal styles share the same handle, so comparing two handles is an integer comparison. A default-constructed handle is the default style; the others are only made by intern, so that every handle refers to an interned style.
+   *
+   */
+  class StyleHandle
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     constexpr StyleHandle(): id_( 0 ) {}
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr uint16_t id() const { return id_; }
+     constexpr bool isDefault() const { return id_ == 0; }
+     const Style& style() const;
+     std::string_view sequence() const;
+
+    private:
+
+     //====================================================
+     //     Private constructors
+     //====================================================
+     constexpr explicit StyleHandle( uint16_t id ): id_( id ) {}
+
+     friend StyleHandle intern( const Style& style );
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     uint16_t id_;
+   };
+
+  constexpr bool operator == ( StyleHandle lhs, StyleHandle rhs ) { return lhs.id() == rhs.id(); }
+  constexpr bool operator != ( StyleHandle lhs, StyleHandle rhs ) { return lhs.id() != rhs.id(); }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // Registry: interning takes a lock, reading an interned style doesn't.
+  extern StyleHandle intern( const Style& style );
+  extern StyleHandle intern( std::string_view sequences );
+  extern size_t interned_styles();
+
+  //====================================================
+  //     Operators
+  //====================================================
+  extern std::ostream& operator << ( std::ostream& os, StyleHandle handle );
+ }
+
+#endif
@@ -0,0 +1,341 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file styled.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_STYLED_HPP
+#define OSMANIP_STYLED_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+// STD headers
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Constants
+  //====================================================
+  inline constexpr size_t STYLED_PREFIX_MAX_SIZE = 64;      /// Maximum size of the combined sequence of a styled string
+  inline constexpr std::string_view STYLED_RESET = "\033[0m";
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // FixedString
+  /**
+   * @brief Fixed-capacity string which can be built in constant expressions. Exceeding the capacity throws, which is a compile-time error in constant expressions.
+   *
+   * @tparam N The maximum number of characters (excluding the null terminator).
+   */
+  template <size_t N>
+  class FixedString
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     constexpr FixedString(): data_{}, size_( 0 ) {}
+
+     //====================================================
+     //     Methods
+     //====================================================
+     constexpr FixedString& append( std::string_view str )
+      {
+       if( str.size() > N - size_ )
+        {
+         throw std::length_error( "FixedString capacity exceeded!" );
+        }
+
+       for( const char c: str ) data_[ size_++ ] = c;
+       data_[ size_ ] = '\0';
+
+       return *this;
+      }
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr const char* data() const { return data_; }
+     constexpr const char* c_str() const { return data_; }
+     constexpr size_t size() const { return size_; }
+     constexpr bool empty() const { return size_ == 0; }
+     constexpr std::string_view view() const { return std::string_view( data_, size_ ); }
+
+     //====================================================
+     //     Operators
+     //====================================================
+     constexpr operator std::string_view() const { return view(); }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     char data_[ N + 1 ];
+     size_t size_;
+   };
+
+  // StyledString
+  /**
+   * @brief String made of a combined SGR prefix, a text and a reset, precomputed as a single byte string.
+   *
+   * @tparam N The capacity of the string.
+   */
+  template <size_t N>
+  class StyledString
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     constexpr StyledString( std::string_view prefix, std::string_view text ):
+      str_(),
+      prefix_size_( prefix.size() ),
+      text_size_( text.size() )
+      {
+       str_.append( prefix ).append( text );
+       if( ! prefix.empty() ) str_.append( STYLED_RESET );
+      }
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr std::string_view str() const { return str_.view(); }
+     constexpr std::string_view text() const { return str_.view().substr( prefix_size_, text_size_ ); }
+     constexpr const char* c_str() const { return str_.c_str(); }
+     constexpr size_t size() const { return str_.size(); }
+
+     //====================================================
+     //     Operators
+     //====================================================
+     constexpr operator std::string_view() const { return str(); }
+     operator std::string() const { return std::string( str() ); }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     FixedString<N> str_;
+     size_t prefix_size_, text_size_;
+   };
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // find_feature_in
+  /**
+   * @brief Searches a feature in a constant table. Only single SGR sequences are returned, otherwise the result is empty.
+   *
+   */
+  template <size_t N>
+  constexpr std::string_view find_feature_in( const feat_table_entry ( &table )[ N ], std::string_view name )
+   {
+    for( const auto& entry: table )
+     {
+      if( entry.first == name && entry.second.size() > 3 && entry.second.substr( 0, 2 ) == "\033[" && entry.second.back() == 'm' )
+       {
+        return entry.second;
+       }
+     }
+    return {};
+   }
+
+  // find_feature
+  /**
+   * @brief Searches a color or a style in the constant tables. Throws if it is not found, which is a compile-time error in constant expressions.
+   *
+   * @param name The name of the color or style.
+   * @return std::string_view The SGR sequence.
+   */
+  constexpr std::string_view find_feature( std::string_view name )
+   {
+    std::string_view sequence = find_feature_in( col_table, name );
+    if( sequence.empty() ) sequence = find_feature_in( sty_table, name );
+    if( sequence.empty() ) throw std::runtime_error( "Inserted color or style is not supported!" );
+
+    return sequence;
+   }
+
+  // SgrFeature
+  /**
+   * @brief SGR sequence of a feature of the constant tables, returned by feat( table, name ). Like the sequences of the feature maps, it is only written into a stream if colors are enabled.
+   *
+   */
+  struct SgrFeature
+   {
+    std::string_view sequence;
+   };
+
+  // feat
+  /**
+   * @brief Same as feat( col, name ), but searching a constant table (col_table, sty_table or rst_table) rather than a map, so that no map is built. The lookup always happens at compile time in C++20, and in C++17 when the result is used in a constant expression, e.g. constexpr auto red = osm::feat( osm::col_table, "red" ); an unsupported feature is then a compile-time error. Example: os << osm::feat( osm::col_table, "red" ) << "Error" << osm::feat( osm::rst_table, "all" );
+   *
+   * @param table The constant table.
+   * @param name The feature name.
+   * @return SgrFeature The SGR sequence.
+   */
+  template <size_t N>
+  OSMANIP_CONSTEVAL SgrFeature feat( const feat_table_entry ( &table )[ N ], std::string_view name )
+   {
+    const std::string_view sequence = find_feature_in( table, name );
+    if( sequence.empty() ) throw std::runtime_error( "Inserted color or style is not supported!" );
+
+    return SgrFeature{ sequence };
+   }
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // Styler
+  /**
+   * @brief Combined SGR prefix of a set of colors and styles, applied to texts with the call operator. It is returned by osm::styled.
+   *
+   */
+  class Styler
+   {
+    public:
+
+     //====================================================
+     //     Constructors
+     //====================================================
+     template <typename... Features>
+     constexpr explicit Styler( const Features&... features ): prefix_()
+      {
+       const std::string_view names[] = { std::string_view(), std::string_view( features )... };
+
+       for( size_t i = 1; i < sizeof...( Features ) + 1; i++ )
+        {
+         const std::string_view sequence = find_feature( names[ i ] );
+         prefix_.append( prefix_.empty() ? "\033[" : ";" ).append( sequence.substr( 2, sequence.size() - 3 ) );
+        }
+
+       if( ! prefix_.empty() ) prefix_.append( "m" );
+      }
+
+     //====================================================
+     //     Getters
+     //====================================================
+     constexpr std::string_view prefix() const { return prefix_.view(); }
+
+     //====================================================
+     //     Operators
+     //====================================================
+     template <size_t N>
+     constexpr StyledString<N - 1 + STYLED_PREFIX_MAX_SIZE + STYLED_RESET.size()> operator () ( const char ( &text )[ N ] ) const
+      {
+       return StyledString<N - 1 + STYLED_PREFIX_MAX_SIZE + STYLED_RESET.size()>( prefix_.view(), std::string_view( text, N - 1 ) );
+      }
+
+    private:
+
+     //====================================================
+     //     Private attributes
+     //====================================================
+     FixedString<STYLED_PREFIX_MAX_SIZE> prefix_;
+   };
+
+  //====================================================
+  //     Factories
+  //====================================================
+
+  // styled
+  /**
+   * @brief Combines colors and styles of the col and sty tables into a single SGR prefix. Used in a constant expression it has no runtime cost, and unknown features are compile-time errors. Example: constexpr auto label = osm::styled( "red", "bold" )( "Error:" );
+   *
+   * @param features The names of the colors and styles.
+   * @return Styler The object which applies them to texts.
+   */
+  template <typename... Features>
+  constexpr Styler styled( const Features&... features )
+   {
+    return Styler( features... );
+   }
+
+#if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+
+  // FeatureName
+  /**
+   * @brief Name of a color or style usable as a template argument.
+   *
+   */
+  template <size_t N>
+  struct FeatureName
+   {
+    char value[ N ];
+
+    constexpr FeatureName( const char ( &str )[ N ] ): value{}
+     {
+      for( size_t i = 0; i < N; i++ ) value[ i ] = str[ i ];
+     }
+   };
+
+  /**
+   * @brief Same as above, with the features as template arguments. Example: constexpr auto label = osm::styled<"red", "bold">( "Error:" );
+   *
+   * @param text The text to be styled.
+   * @return The styled string.
+   */
+  template <FeatureName... Features, size_t N>
+    requires ( sizeof...( Features ) > 0 )
+  consteval auto styled( const char ( &text )[ N ] )
+   {
+    return Styler( std::string_view( Features.value )... )( text );
+   }
+
+#endif
+
+  //====================================================
+  //     Operators
+  //====================================================
+
+  // operator <<
+  /**
+   * @brief Writes the styled string into the stream, or only its text if colors are disabled.
+   *
+   */
+  template <size_t N>
+  std::ostream& operator << ( std::ostream& os, const StyledString<N>& str )
+   {
+    const std::string_view view = colors_enabled() ? str.str() : str.text();
+    return os.write( view.data(), static_cast<std::streamsize>( view.size() ) );
+   }
+
+  /**
+   * @brief Writes the SGR sequence into the stream, if colors are enabled.
+   *
+   */
+  inline std::ostream& operator << ( std::ostream& os, const SgrFeature& feature )
+   {
+    if( ! colors_enabled() ) return os;
+    return os.write( feature.sequence.data(), static_cast<std::streamsize>( feature.sequence.size() ) );
+   }
+ }
+
+#endif
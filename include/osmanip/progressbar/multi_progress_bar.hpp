@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_MULTIPROGRESSBAR_HPP
 #define OSMANIP_MULTIPROGRESSBAR_HPP
@@ -161,20 +162,14 @@ namespace osm
       {
        std::lock_guard <std::mutex> lock{ mutex_ };
        int32_t idx_delta = idx - last_updated_index;
-       std::string direction;
 
        if( idx_delta < 0 )
         {
-         direction = "up";
-         idx_delta = -idx_delta;
+         cursor_up( osm::cout, -idx_delta );
         }
-       else
+       else if( idx_delta > 0 )
         {
-         direction = "down";
-        }
-       for( int32_t i = 0; i < idx_delta; i++ )
-        {                                                                                                               
-         osm::cout << feat( crs, direction, 1 );
+         cursor_down( osm::cout, idx_delta );
         }
        last_updated_index = idx;
        [](...) {} 
@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_PROGRESSBAR_HPP
 #define OSMANIP_PROGRESSBAR_HPP
@@ -23,7 +24,12 @@
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/gradient.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 //Extra headers
 #include <arsenalgear/constants.hpp>
@@ -41,6 +47,7 @@
 #include <cmath>
 #include <stdexcept>
 #include <ratio>
+#include <type_traits>
 #include <stdint.h>
 
 namespace osm
@@ -268,8 +275,40 @@ namespace osm
      void setColor( const std::string& color )
       { 
        color_ = feat( col, color );
+       color_style_ = intern( color_ );
        color_name_ = color;
       }
+
+     /**
+      * @brief Set the color of the ProgressBar as an interned style, which may also carry a background and text attributes.
+      * 
+      * @tparam bar_type The type of the ProgressBar.
+      * @param style The style of the ProgressBar.
+      */
+     void setColor( StyleHandle style )
+      { 
+       color_ = style.sequence();
+       color_style_ = style;
+       color_name_ = "";
+      }
+   
+     // setGradient
+     /**
+      * @brief Set a gradient coloring the bar of loader and complete progress bars from its first to its last cell. The color of each cell is taken from the gradient once, here, so that updates cost as much as with a solid color.
+      * 
+      * @tparam bar_type The type of the ProgressBar.
+      * @param gradient The gradient of the bar.
+      */
+     void setGradient( const Gradient& gradient )
+      { 
+       const size_t cells = std::is_floating_point_v<bar_type> ? 26 : 25;
+
+       gradient_.clear();
+       if( gradient.empty() ) return;
+
+       gradient_.reserve( cells );
+       for( size_t i = 0; i < cells; i++ ) gradient_.push_back( gradient.sample( i, cells ) );
+      }
    
      // setRemainingTimeFlag
      /**
@@ -306,6 +345,8 @@ namespace osm
        brackets_open_ = "", 
        brackets_close_= "", 
        color_ = feat( rst, "color" ); 
+       color_style_ = StyleHandle();
+       gradient_.clear();
        color_name_ = "";
        time_flag_ = "off";
       }
@@ -399,6 +440,8 @@ namespace osm
       void resetColor()
        { 
         color_ = feat( rst, "color" ); 
+        color_style_ = StyleHandle();
+        gradient_.clear();
         color_name_ = "";
        }
  
@@ -553,6 +596,18 @@ namespace osm
       { 
        return color_name_; 
       }
+
+     // getColorStyle
+     /** 
+      * @brief Get the interned style of the ProgressBar color.
+      * 
+      * @tparam bar_type The type of the ProgressBar.
+      * @return The handle of the ProgressBar color style.
+      */
+     StyleHandle getColorStyle() const
+      { 
+       return color_style_; 
+      }
    
      // getRemainingTimeFlag
      /** 
@@ -579,20 +634,29 @@ namespace osm
       */
      void update( bar_type iterating_var )
       {
+       if constexpr( ! OUTPUT_ENABLED )
+        {
+         ( void )iterating_var;
+         return;
+        }
+
        std::lock_guard <std::mutex> lock{ mutex_ };
    
        iterating_var_ = 100 * ( iterating_var - min_ ) / ( max_ - min_ - agr::one( iterating_var ) ),
        iterating_var_spin_ = agr::isFloatingPoint( iterating_var ) ? ( agr::roundoff( iterating_var, 1 ) * 10 ) : iterating_var,
        width_ = ( iterating_var_ + 1 ) / 4;
    
+       //Color changes are tracked, so that only the needed sequences are emitted, over the style of the stream:
+       SgrState sgr = SgrState::over( current_style( osm::cout ) );
+
        //Update of the progress indicator only:
        if( styles_map_.at( "indicator" ).find( style_ ) != styles_map_.at( "indicator" ).end() )
         {
-         output_ = feat( crs, "left", 100 ) + 
-                   getColor() +
-                   std::to_string( static_cast <int32_t> ( round( iterating_var_ ++ ) ) ) +
-                   feat( rst, "color" ) + 
-                   getStyle();
+         output_ = cursor_left( 100 );
+         output_ += sgr.apply( color_style_.style() );
+         output_ += std::to_string( static_cast <int32_t> ( round( iterating_var_ ++ ) ) );
+         output_ += sgr.reset();
+         output_ += getStyle();
    
          update_output( output_ );
         }
@@ -600,13 +664,12 @@ namespace osm
        //Update of the loader indicator only:
        else if( styles_map_.at( "loader" ).find( style_ ) != styles_map_.at( "loader" ).end() )
         {
-         output_ = feat( crs, "left", 100 ) + 
-                   getBrackets_open() + 
-                   getColor() + 
-                   getStyle() * width_ + 
-                   agr::empty_space<std::string> * ( ( agr::isFloatingPoint( iterating_var ) ? 26 : 25 ) - width_ ) + 
-                   feat( rst, "color" ) + 
-                   getBrackets_close();  
+         output_ = cursor_left( 100 );
+         output_ += getBrackets_open();
+         append_bar( sgr, getStyle() );
+         output_ += agr::empty_space<std::string> * ( ( agr::isFloatingPoint( iterating_var ) ? 26 : 25 ) - width_ );
+         output_ += sgr.reset();
+         output_ += getBrackets_close();  
                         
          update_output( output_ );
    
@@ -616,18 +679,17 @@ namespace osm
        else if ( style_.find( style_p_ ) != std::string::npos && style_.find( style_l_ ) != std::string::npos &&
                  type_ == "complete"  )
         {
-         output_= feat( crs, "left", 100 ) + 
-                  getBrackets_open() + 
-                  getColor() + 
-                  style_l_ * width_ + 
-                  agr::empty_space<std::string> * ( ( agr::isFloatingPoint( iterating_var ) ? 26 : 25 ) - width_ ) + 
-                  feat( rst, "color" ) +
-                  getBrackets_close() + 
-                  getColor() + 
-                  agr::empty_space<std::string> + 
-                  std::to_string( static_cast <int32_t> ( round( iterating_var_ ++ ) ) ) + 
-                  feat( rst, "color" ) + 
-                  style_p_; 
+         output_ = cursor_left( 100 );
+         output_ += getBrackets_open();
+         append_bar( sgr, style_l_ );
+         output_ += agr::empty_space<std::string> * ( ( agr::isFloatingPoint( iterating_var ) ? 26 : 25 ) - width_ );
+         output_ += sgr.reset();
+         output_ += getBrackets_close();
+         output_ += sgr.apply( color_style_.style() );
+         output_ += agr::empty_space<std::string>;
+         output_ += std::to_string( static_cast <int32_t> ( round( iterating_var_ ++ ) ) );
+         output_ += sgr.reset();
+         output_ += style_p_; 
    
          update_output( output_ );
         }
@@ -635,14 +697,16 @@ namespace osm
        //Update of the progress spinner:
        else if( styles_map_.at( "spinner" ).find( style_ ) != styles_map_.at( "spinner" ).end() )
         {
-         output_ = feat( crs, "left", 100 ) + 
-                   getColor() +
-                   getStyle()[ static_cast <uint64_t> ( iterating_var_spin_ ) & 3 ] +
-                   feat( col, "green" ) +
-                    ( ( agr::roundoff( iterating_var, 1 ) == agr::roundoff( max_, 1 ) - agr::one( iterating_var ) ) ?
-                      ( static_cast <std::string> ( feat( crs, "left", 100 ) + "0" ) ) : ""
-                    ) +
-                   feat( rst, "color" );
+         output_ = cursor_left( 100 );
+         output_ += sgr.apply( color_style_.style() );
+         output_ += getStyle()[ static_cast <uint64_t> ( iterating_var_spin_ ) & 3 ];
+         output_ += sgr.apply( green_sgr );
+         if( agr::roundoff( iterating_var, 1 ) == agr::roundoff( max_, 1 ) - agr::one( iterating_var ) )
+          {
+           output_ += cursor_left( 100 );
+           output_ += "0";
+          }
+         output_ += sgr.reset();
    
          update_output( output_ );
         }
@@ -691,6 +755,32 @@ namespace osm
      //     Private methods
      //====================================================
 
+     // append_bar
+     /** 
+      * @brief Append the filled cells of the bar to the output, with the solid color or the gradient of the ProgressBar. The output is left in the solid color.
+      * 
+      * @tparam bar_type The type of the ProgressBar.
+      * @param sgr The SGR state of the output.
+      * @param cell The string of a filled cell.
+      */
+     void append_bar( SgrState& sgr, const std::string& cell )
+      {
+       if( ! gradient_.empty() )
+        {
+         const size_t cells = width_ > 0 ? static_cast<size_t>( width_ ) : 0;
+         for( size_t i = 0; i < cells && i < gradient_.size(); i++ )
+          {
+           output_ += sgr.apply( gradient_[ i ].style() );
+           output_ += cell;
+          }
+         output_ += sgr.apply( color_style_.style() );
+         return;
+        }
+
+       output_ += sgr.apply( color_style_.style() );
+       output_ += cell * width_;
+      }
+
      // remaining_time
      /** 
       * @brief Compute the remaining time for the completion of the progress bar.
@@ -710,12 +800,16 @@ namespace osm
        std::chrono::minutes minutes_left = std::chrono::duration_cast <std::chrono::minutes> ( time_left );
        std::chrono::seconds seconds_left = std::chrono::duration_cast <std::chrono::seconds> ( time_left - minutes_left );
    
-       osm::cout << "["
-                 << feat( sty, "italics" ) + "Estimated time left: "  + feat( rst, "italics" )
-                 << feat( col, "green" ) << minutes_left.count() << feat( rst, "color" ) << "m " 
-                 << feat( col, "green" ) << seconds_left.count() << feat( rst, "color" ) << "s" 
-                 << "]"
-                 << feat( tcsc, "cln", 0 );      
+       SgrState sgr = SgrState::over( current_style( osm::cout ) );
+
+       osm::cout << "[";
+       sgr.apply( osm::cout, Style{ {}, {}, ATTR::ITALICS } ) << "Estimated time left: ";
+       sgr.apply( osm::cout, green_sgr ) << minutes_left.count();
+       sgr.reset( osm::cout ) << "m ";
+       sgr.apply( osm::cout, green_sgr ) << seconds_left.count();
+       sgr.reset( osm::cout ) << "s"
+                              << "]"
+                              << clear_line( 0 );      
       }
 
      // update_output
@@ -727,12 +821,13 @@ namespace osm
       */
      void update_output( const std::string& output )
       {    
-       osm::cout << output
-                 << getColor()
-                 << ( ( message_ != agr::null_str<std::string> ) ?
-                    ( agr::empty_space<std::string> + message_ + agr::empty_space<std::string> ) :
-                    agr::empty_space<std::string> )
-                 << feat( rst, "color" );
+       SgrState sgr = SgrState::over( current_style( osm::cout ) );
+
+       osm::cout << output;
+       sgr.apply( osm::cout, color_style_.style() ) << ( ( message_ != agr::null_str<std::string> ) ?
+                                               ( agr::empty_space<std::string> + message_ + agr::empty_space<std::string> ) :
+                                               agr::empty_space<std::string> );
+       sgr.reset( osm::cout );
    
        if( time_flag_ == "on" )
         {
@@ -747,6 +842,7 @@ namespace osm
      //     Private static attributes
      //====================================================
       static string_set_map styles_map_;
+      static constexpr Style green_sgr { Color::basic( 2 ), {}, ATTR::NONE };
       static std::vector <bar_type> counter_;
       static std::mutex mutex_;
      
@@ -758,6 +854,8 @@ namespace osm
       bar_type max_, max_spin_, min_, iterating_var_, iterating_var_spin_, width_;
       std::string style_, style_p_, style_l_, type_, conct_, message_, brackets_open_, brackets_close_, 
                   output_, color_, time_flag_, color_name_;
+      StyleHandle color_style_;
+      std::vector<StyleHandle> gradient_;
       steady_clock::time_point begin, end, begin_timer;
    };
 
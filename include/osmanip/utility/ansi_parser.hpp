@@ -0,0 +1,171 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_parser.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_ANSI_PARSER_HPP
+#define OSMANIP_ANSI_PARSER_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/sgr.hpp>
+
+// STD headers
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // AnsiCsi
+  /**
+   * @brief A parsed CSI (Control Sequence Introducer) sequence: ESC [ prefix params intermediate final. Parameters past MAX_PARAMS are dropped, and an empty parameter is stored as 0.
+   *
+   * @example "\033[?25l" has prefix '?', the single parameter 25 and final 'l'.
+   */
+  struct AnsiCsi
+  {
+    static constexpr size_t MAX_PARAMS = 16;
+
+    uint32_t params[ MAX_PARAMS ];
+    uint8_t size;
+    uint16_t subparams;     /// Bit i is set if params[ i ] is a sub-parameter, i.e. it follows a ':' instead of a ';'
+    char prefix;            /// Private marker ('<', '=', '>' or '?'), or '\0'
+    char intermediate;      /// Last intermediate byte (0x20 to 0x2F), or '\0'
+    char final;
+
+    // param
+    /**
+     * @brief Returns a parameter, or a default value if it is missing or 0 as most sequences require (e.g. "ESC[A" and "ESC[0A" move by 1).
+     *
+     */
+    constexpr uint32_t param( size_t index, uint32_t def = 0 ) const
+    {
+      return index < size && params[ index ] != 0 ? params[ index ] : def;
+    }
+  };
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // AnsiHandler
+  /**
+   * @brief Receives the events of an AnsiParser. Every method does nothing by default, so that a handler overrides only the events it needs.
+   *
+   */
+  class AnsiHandler
+  {
+    public:
+    //====================================================
+    //     Destructor
+    //====================================================
+
+    virtual ~AnsiHandler() = default;
+
+    //====================================================
+    //     Events
+    //====================================================
+
+    virtual void text( [[maybe_unused]] std::string_view run ) {}                          /// Printable characters, UTF-8 included. The view is only valid during the call
+    virtual void control( [[maybe_unused]] char code ) {}                                  /// C0 control character, e.g. '\n', '\r' or '\b'
+    virtual void csi( [[maybe_unused]] const AnsiCsi & csi ) {}                            /// CSI sequence other than SGR
+    virtual void sgr( [[maybe_unused]] const Style & style ) {}                            /// SGR sequence, as the style it results in
+    virtual void esc( [[maybe_unused]] char final, [[maybe_unused]] char intermediate ) {} /// Other escape sequences, e.g. "ESC 7"
+    virtual void osc( [[maybe_unused]] std::string_view data ) {}                          /// OSC string, e.g. "0;title". The view is only valid during the call
+  };
+
+  // AnsiParser
+  /**
+   * @brief State machine splitting a stream into text runs and parsed control sequences, following the VT500 parser. Text runs are found a block at a time with find_control, sequences are parsed byte by byte. Input can be fed in chunks of any size: a sequence split between two chunks is completed by the next one. Text runs point into the input and sequences are collected in fixed-size buffers, so the parser never allocates. DCS, SOS, PM and APC strings are consumed and ignored.
+   *
+   */
+  class AnsiParser
+  {
+    public:
+    //====================================================
+    //     Constants
+    //====================================================
+
+    static constexpr size_t MAX_OSC_SIZE = 256;      /// OSC strings are truncated to this size
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    AnsiParser() = default;
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void feed( std::string_view chunk, AnsiHandler & handler );
+    void reset();
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    bool isGround() const { return state_ == STATE::GROUND; }      /// False if a sequence is still pending
+    const Style & style() const { return style_; }                 /// The style resulting from the SGR sequences seen so far
+
+    private:
+    //====================================================
+    //     Enum classes
+    //====================================================
+
+    enum class STATE : uint8_t
+    {
+      GROUND,
+      ESCAPE,
+      ESCAPE_INTERMEDIATE,
+      CSI_PARAM,
+      CSI_INTERMEDIATE,
+      CSI_IGNORE,
+      OSC_STRING,
+      IGNORE_STRING
+    };
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    void dispatch_csi( char final, AnsiHandler & handler );
+    void clear_csi();
+
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    STATE state_ = STATE::GROUND;
+    AnsiCsi csi_ {};
+    uint32_t param_ = 0;
+    bool has_param_ = false;
+    bool sub_param_ = false;      /// The current parameter follows a ':'
+    char intermediate_ = '\0';
+    uint16_t osc_size_ = 0;
+    char osc_[ MAX_OSC_SIZE ];
+    Style style_;
+  };
+
+}      // namespace osm
+
+#endif
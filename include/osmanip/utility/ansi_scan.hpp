@@ -0,0 +1,45 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_scan.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_ANSI_SCAN_HPP
+#define OSMANIP_ANSI_SCAN_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <string>
+#include <string_view>
+#include <stddef.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // Block scanning of text: 32 bytes at a time with AVX2, 16 with SSE2, otherwise memchr or 8 bytes at a time in a word
+  extern size_t find_escape( std::string_view str, size_t pos = 0 );
+  extern size_t find_control( std::string_view str, size_t pos = 0 );
+  extern size_t escape_size( std::string_view str, size_t pos );
+  extern std::string strip_ansi( std::string_view str );
+  extern void strip_ansi( std::string_view str, std::string & out );
+  extern const char * scan_method();
+
+}      // namespace osm
+
+#endif
@@ -0,0 +1,120 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file config.hpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#ifndef OSMANIP_CONFIG_HPP
+#define OSMANIP_CONFIG_HPP
+
+//====================================================
+//     Linkage macros
+//====================================================
+
+// With OSMANIP_HEADER_ONLY defined the sources are compiled in every translation unit including an osmanip header: the
+// functions and variables they define become inline, so that calls with constant arguments can be folded by the optimizer.
+#ifdef OSMANIP_HEADER_ONLY
+#define OSMANIP_INLINE inline      /// Prefix of the definitions of the sources
+#define OSMANIP_STATIC inline      /// Prefix of the helpers of the sources, declared in osm::detail and shared by all the translation units
+#else
+#define OSMANIP_INLINE
+#define OSMANIP_STATIC static
+#endif
+
+// Globals which must have no static initialization cost are checked to be constant-initialized where constinit is available.
+#ifdef __cpp_constinit
+#define OSMANIP_CONSTINIT constinit
+#else
+#define OSMANIP_CONSTINIT
+#endif
+
+// Functions which must be evaluated at compile time are checked to be so where consteval is available.
+#ifdef __cpp_consteval
+#define OSMANIP_CONSTEVAL consteval
+#else
+#define OSMANIP_CONSTEVAL constexpr
+#endif
+
+//====================================================
+//     Header-only mode
+//====================================================
+
+// This header is included first by every osmanip header: the first time it is met it declares the whole library and
+// then defines it, so that a source never sees a header which is only partially parsed.
+#ifdef OSMANIP_HEADER_ONLY
+
+#define OSMANIP_STRINGIFY_IMPL( x ) #x
+#define OSMANIP_STRINGIFY( x ) OSMANIP_STRINGIFY_IMPL( x )
+
+// Sources are installed in include/osmanip/src, and are in src in the source tree.
+#if __has_include( "../src/utility/terminal.cpp" )
+#define OSMANIP_SOURCE( file ) OSMANIP_STRINGIFY( ../src/file )
+#else
+#define OSMANIP_SOURCE( file ) OSMANIP_STRINGIFY( ../../../src/file )
+#endif
+
+// Declarations
+#include <osmanip/utility/options.hpp>
+#include <osmanip/utility/small_string.hpp>
+#include <osmanip/utility/terminal.hpp>
+#include <osmanip/utility/strings.hpp>
+#include <osmanip/utility/sstream.hpp>
+#include <osmanip/utility/output_redirector.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/windows.hpp>
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/utility/ansi_scan.hpp>
+#include <osmanip/utility/display_width.hpp>
+#include <osmanip/utility/html.hpp>
+#include <osmanip/utility/screen.hpp>
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/cursor.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/styled.hpp>
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/gradient.hpp>
+#include <osmanip/manipulators/printer.hpp>
+#include <osmanip/manipulators/decorator.hpp>
+#include <osmanip/graphics/canvas.hpp>
+#include <osmanip/graphics/plot_2D.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/progressbar/multi_progress_bar.hpp>
+
+// Definitions
+#include OSMANIP_SOURCE( utility/terminal.cpp )
+#include OSMANIP_SOURCE( utility/strings.cpp )
+#include OSMANIP_SOURCE( utility/sstream.cpp )
+#include OSMANIP_SOURCE( utility/output_redirector.cpp )
+#include OSMANIP_SOURCE( utility/iostream.cpp )
+#include OSMANIP_SOURCE( utility/windows.cpp )
+#include OSMANIP_SOURCE( utility/ansi_parser.cpp )
+#include OSMANIP_SOURCE( utility/ansi_scan.cpp )
+#include OSMANIP_SOURCE( utility/display_width.cpp )
+#include OSMANIP_SOURCE( utility/html.cpp )
+#include OSMANIP_SOURCE( utility/screen.cpp )
+#include OSMANIP_SOURCE( utility/sink.cpp )
+#include OSMANIP_SOURCE( manipulators/common.cpp )
+#include OSMANIP_SOURCE( manipulators/colsty.cpp )
+#include OSMANIP_SOURCE( manipulators/cursor.cpp )
+#include OSMANIP_SOURCE( manipulators/sgr.cpp )
+#include OSMANIP_SOURCE( manipulators/stream_style.cpp )
+#include OSMANIP_SOURCE( manipulators/style_registry.cpp )
+#include OSMANIP_SOURCE( manipulators/gradient.cpp )
+#include OSMANIP_SOURCE( manipulators/printer.cpp )
+#include OSMANIP_SOURCE( manipulators/decorator.cpp )
+#include OSMANIP_SOURCE( graphics/canvas.cpp )
+#include OSMANIP_SOURCE( graphics/plot_2D.cpp )
+
+#endif
+
+#endif
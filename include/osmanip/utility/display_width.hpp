@@ -0,0 +1,39 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file display_width.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_DISPLAY_WIDTH_HPP
+#define OSMANIP_DISPLAY_WIDTH_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <string_view>
+#include <stddef.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  extern int char_width( char32_t ch );
+  extern size_t display_width( std::string_view str );
+
+}      // namespace osm
+
+#endif
@@ -0,0 +1,109 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file html.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_HTML_HPP
+#define OSMANIP_HTML_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+
+// STD headers
+#include <istream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // HtmlConverter
+  /**
+   * @brief Streaming converter of output containing escape sequences to HTML. Text is escaped, and each run of text with a non-default SGR style is wrapped in a single <span> with an inline CSS style; consecutive runs with the same style share the span. Other sequences and control characters but new lines and tabs are dropped. Memory use is constant: the output is buffered and written in blocks of CHUNK_SIZE characters.
+   *
+   * @details The result is meant to be placed in a <pre> element. Call end() after the last chunk, to close the open span and write the buffered output.
+   *
+   * The stream is converted as it is, so it must hold the escape sequences: a file written by an OutputRedirector keeps them only in styled mode (see OutputRedirector::setStyled). Redraws are not applied either, e.g. a line rewritten after a carriage return follows the previous text: output with progress bars is best converted from such a file, whose lines are already rendered.
+   */
+  class HtmlConverter: private AnsiHandler
+  {
+    public:
+    //====================================================
+    //     Constants
+    //====================================================
+
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;      /// Size of the output blocks and of the chunks read by convert
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit HtmlConverter( std::ostream & out );
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void feed( std::string_view chunk );
+    void end();
+
+    static void convert( std::istream & in, std::ostream & out );
+
+    private:
+    //====================================================
+    //     Events
+    //====================================================
+
+    void text( std::string_view run ) override;
+    void control( char code ) override;
+    void sgr( const Style & style ) override;
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    void open_span();
+    void close_span();
+    void flush_buffer();
+
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    std::ostream & out_;
+    std::string buffer_;
+    AnsiParser parser_;
+    Style style_, span_style_;
+    bool span_open_;
+  };
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  extern std::string ansi_to_html( std::string_view str );
+
+}      // namespace osm
+
+#endif
@@ -12,6 +12,7 @@
 //     Preprocessor settings
 //====================================================
 
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_COUT_INCLUDE_UTILITY_IOSTREAM_HPP
 #  define OSMANIP_COUT_INCLUDE_UTILITY_IOSTREAM_HPP
@@ -34,7 +35,7 @@ namespace osm
   //====================================================
 
   extern std::ostream cout;              /// Linked to standard output
-  extern OutputRedirector redirout;      /// Linked to output redirection
+  extern LazyOutputRedirector redirout;      /// Linked to output redirection
 
 }      // namespace osm
 
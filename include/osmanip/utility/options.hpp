@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_OPTIONS_HPP
 #define OSMANIP_OPTIONS_HPP
@@ -22,6 +23,7 @@
 //My headers
 #include <osmanip/utility/windows.hpp>
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/terminal.hpp>
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/common.hpp>
@@ -87,6 +89,10 @@ namespace osm
       if ( opt == UNICODECH::ON ) enableUNICODE();
       else if ( opt == UNICODECH::OFF ) disableUNICODE();
      }
+    else if constexpr ( std::is_same_v<T, ESCAPES> ) 
+     {
+      setEscapes( opt );
+     }
     else std::cerr << feat( col, "red" ) << "Inserted cursor option is not supported!"  << feat( rst, "all" ) << "\n";
    }
  }
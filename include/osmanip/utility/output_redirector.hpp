@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_OUTPUTREDIRECTOR_HPP
 #  define OSMANIP_OUTPUTREDIRECTOR_HPP
@@ -21,13 +22,20 @@
 
 // My headers
 #include <osmanip/utility/sstream.hpp>
+#include <osmanip/utility/screen.hpp>
 
 // STD headers
 #include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
 #include <filesystem>
+#include <mutex>
+#include <stddef.h>
 #include <stdint.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace osm
  {
@@ -36,14 +44,59 @@ namespace osm
   //====================================================
   namespace fs = std::filesystem;
 
+  //====================================================
+  //     Enum classes
+  //====================================================
+
+  // OVERFLOW_POLICY
+  /**
+   * @brief What an asynchronous OutputRedirector does with new output when the output waiting for the writer thread fills its buffer: BLOCK waits until the writer has taken it, DROP discards the new output.
+   *
+   */
+  enum class OVERFLOW_POLICY { BLOCK, DROP };
+
   //====================================================
   //     Classes
   //====================================================
 
+  // LazyString
+  /**
+   * @brief A constant string only computed the first time it is used, so that it costs nothing at startup. It converts to a const std::string &.
+   *
+   */
+  class LazyString
+   {
+    public:
+
+    constexpr explicit LazyString( const std::string & ( *get )() ): get_( get ) {}
+
+    operator const std::string &() const { return get_(); }
+    const std::string & str() const { return get_(); }
+
+    friend bool operator==( const LazyString & lhs, const std::string & rhs ) { return lhs.str() == rhs; }
+    friend bool operator==( const std::string & lhs, const LazyString & rhs ) { return lhs == rhs.str(); }
+    friend bool operator!=( const LazyString & lhs, const std::string & rhs ) { return lhs.str() != rhs; }
+    friend bool operator!=( const std::string & lhs, const LazyString & rhs ) { return lhs != rhs.str(); }
+    friend std::ostream & operator<<( std::ostream & os, const LazyString & string ) { return os << string.str(); }
+
+    private:
+
+    const std::string & ( *get_ )();
+   };
+
   // OutputRedirector
   /**
    * @brief This class is used to redirected output to a file.
    *
+   * @details The output is rendered on a Screen, as a terminal would display it. Lines scrolled off the screen can no longer change: they are appended to the file, which is kept open while redirection is enabled. The offset of each line of the screen in the file is recorded, and a line changed by a flush, e.g. a progress bar, is overwritten in place, padded with spaces if it became shorter; the following lines are rewritten only if it became longer, which costs nothing for the last line. A flush therefore costs time proportional to the changed lines, not to the size of the file or of the screen, and a process reading the file while it is written always sees the current state. The padding is removed when the line scrolls off the screen and when the file is closed.
+   *
+   * The size of the file can be capped, see setMaxSize: once exceeded, the file is renamed with a number and a new one is started, which only needs the lines of the screen to be written again.
+   *
+   * In tee mode (see setTee) the output of osm::cout is also sent, unchanged, to its stream, e.g. the terminal: a job can be watched live while the file keeps the plain rendered text.
+   *
+   * In styled mode (see setStyled) each line of the file is written with the SGR sequences of the styles of its text, as displayed on the Screen, instead of as plain text.
+   *
+   * In asynchronous mode (see setAsync) a flush only copies the output to a buffer, and a writer thread renders and writes it. Two buffers are swapped between the producers and the writer, so that either side works while the other one does, and the output waiting for the writer is bounded by the given size. flush() and end() wait until everything handed over has been written, and so does the destructor at exit. On a fatal signal (SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV or SIGTERM) the output already handed over is given up to a second to be written, then the previous handler of the signal is called. These handlers are only installed while a writer thread is running: the previous ones are restored when the last one stops.
    */
   class OutputRedirector
    : public std::ostream
@@ -68,6 +121,10 @@ namespace osm
     //====================================================
 
     void setFilename( const std::string & filename );
+    void setAsync( bool async, size_t buffer_size = DEFAULT_BUFFER_SIZE, OVERFLOW_POLICY policy = OVERFLOW_POLICY::BLOCK );
+    void setMaxSize( uintmax_t max_size, size_t rotated_files = 1 );
+    void setTee( bool tee );
+    void setStyled( bool styled );
 
     //====================================================
     //     Getters
@@ -75,6 +132,7 @@ namespace osm
 
     [[nodiscard]] std::string & getFilename();
     [[nodiscard]] std::string & getFilepath();
+    [[nodiscard]] size_t getDroppedSize();
 
     //====================================================
     //     Methods
@@ -83,32 +141,74 @@ namespace osm
     void end();
     void begin();
     void touch();
+    OutputRedirector & flush();
 
     bool isEnabled();
+    bool isAsync();
+    bool isTee();
+    bool isStyled();
 
     //====================================================
-    //     Static public variables
+    //     Static public members
     //====================================================
 
-    static const std::string DEFAULT_FILE_DIR;
-    static const std::string DEFAULT_FILEPATH;
-    static const std::string DEFAULT_FILENAME;
+    static const LazyString DEFAULT_FILENAME;
+    static const LazyString DEFAULT_FILE_DIR;      /// Kept for compatibility, the working directory is only read when they are first used:
+    static const LazyString DEFAULT_FILEPATH;      /// prefer defaultFileDir() and getFilepath()
+    static constexpr size_t SCREEN_WIDTH = 4096;      /// Size of the screen the output is rendered on: lines are only stored up to their last character,
+    static constexpr size_t SCREEN_HEIGHT = 256;      /// and the cursor can move back over this many lines
+    static constexpr size_t DEFAULT_BUFFER_SIZE = 1 << 20;      /// Size of the output which can wait for the writer thread in asynchronous mode
+    static const std::string & defaultFileDir();
 
     private:
     //====================================================
     //     Private attributes
     //====================================================
     std::atomic<bool> enabled_;
+    std::atomic<bool> tee_;
+    std::atomic<bool> styled_;
 
-    std::string file_dir_;
     std::string filename_;
     std::string filepath_;
 
     std::fstream fstream_;
-    std::stringstream output_str_;
+    Screen screen_;
+    bool file_read_;
+    std::string output_;
+    uintmax_t committed_;      /// Size of the final part of the file, the lines of the screen follow it
+    uintmax_t file_size_;      /// Size of the file as last written
+    uintmax_t max_size_;       /// Size after which the file is rotated, 0 if unlimited
+    size_t rotated_files_;     /// Number of rotated files kept
+
+    // LiveLine
+    /**
+     * @brief A line of the screen as written to the file. Its new line, if any, follows the reserved characters.
+     *
+     */
+    struct LiveLine
+    {
+      std::string text;
+      uintmax_t offset;
+      size_t reserved;      /// At least the size of the text, the rest is padding
+      bool wrapped;         /// True if the line continues on the next one, i.e. no new line follows
+    };
+    std::vector<LiveLine> live_;      /// Lines of the screen and lines scrolled off since the last flush, one per row
 
-    int32_t last_ansi_str_index_;
-    int32_t last_ansi_str_size_;
+    // Asynchronous mode
+    std::atomic<bool> async_;
+    OVERFLOW_POLICY policy_;
+    size_t buffer_size_;
+    std::string pending_;      /// Output handed over by the producers
+    std::string writing_;      /// Output being written by the writer thread, swapped with pending_
+    std::mutex queue_mutex_;
+    std::condition_variable queue_cv_;      /// Wakes the writer thread
+    std::condition_variable done_cv_;       /// Wakes the producers waiting for room or for a flush
+    std::thread writer_;
+    bool stop_;
+    std::atomic<uint64_t> handed_over_;      /// Number of handovers, and of those already written
+    std::atomic<uint64_t> written_;
+    std::atomic<size_t> dropped_;
+    std::exception_ptr error_;
 
     //====================================================
     //     Private methods
@@ -118,15 +218,92 @@ namespace osm
     int32_t sync() override;
 
     // Helpers
+    void open_file();
+    void close_file();
     void write_output();
+    void rewrite_lines( size_t first );
+    void rotate_file();
     void prepare_output();
     void read_file();
+    void hand_over();
+    void start_writer();
+    void stop_writer();
+    void writer_loop();
+    void wait_written();
+    void check_error();
+
+    static void set_signal_handlers( bool install );
+    static void drain_writers();
 
     // Exceptions
     void sanity_check( const std::string & func_name );
     void exception_file_not_found();
   };
 
+  // LazyOutputRedirector
+  /**
+   * @brief Handle to the global OutputRedirector, which is created the first time it is used. The handle itself is constant-initialized, and checking whether redirection is enabled never creates the redirector.
+   *
+   */
+  class LazyOutputRedirector
+  {
+    public:
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    constexpr LazyOutputRedirector() = default;
+
+    LazyOutputRedirector( const LazyOutputRedirector & ) = delete;
+    LazyOutputRedirector & operator=( const LazyOutputRedirector & ) = delete;
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    OutputRedirector & get();
+    OutputRedirector * operator->() { return &get(); }
+    operator OutputRedirector &() { return get(); }
+    operator std::ostream &() { return get(); }
+
+    //====================================================
+    //     Operators
+    //====================================================
+
+    // operator <<
+    /**
+     * @brief Writes to the global redirector, as when osm::redirout was the OutputRedirector itself.
+     *
+     */
+    template <typename T>
+    std::ostream & operator<<( const T & value ) { return get() << value; }
+    std::ostream & operator<<( std::ostream & ( *manipulator )( std::ostream & ) ) { return get() << manipulator; }
+    std::ostream & operator<<( std::ios_base & ( *manipulator )( std::ios_base & ) ) { return get() << manipulator; }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void setFilename( const std::string & filename ) { get().setFilename( filename ); }
+    void setAsync( bool async, size_t buffer_size = OutputRedirector::DEFAULT_BUFFER_SIZE, OVERFLOW_POLICY policy = OVERFLOW_POLICY::BLOCK ) { get().setAsync( async, buffer_size, policy ); }
+    void setMaxSize( uintmax_t max_size, size_t rotated_files = 1 ) { get().setMaxSize( max_size, rotated_files ); }
+    void setTee( bool tee ) { get().setTee( tee ); }
+    void setStyled( bool styled ) { get().setStyled( styled ); }
+    [[nodiscard]] std::string & getFilename() { return get().getFilename(); }
+    [[nodiscard]] std::string & getFilepath() { return get().getFilepath(); }
+    [[nodiscard]] size_t getDroppedSize() { return get().getDroppedSize(); }
+
+    void end() { get().end(); }
+    void begin() { get().begin(); }
+    void touch() { get().touch(); }
+    void flush() { get().flush(); }
+
+    bool isEnabled() const;
+    bool isTee() const;
+    bool isAsync() { return get().isAsync(); }
+    bool isStyled() { return get().isStyled(); }
+  };
+
  }      // namespace osm
 
 #endif
\ No newline at end of file
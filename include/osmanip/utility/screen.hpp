@@ -0,0 +1,191 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file screen.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_SCREEN_HPP
+#define OSMANIP_SCREEN_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+
+// STD headers
+#include <deque>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // Cell
+  /**
+   * @brief A character cell of a Screen. Cells which were never written, or were erased, hold the null character and are rendered as spaces. A tab is kept as a cell holding it, followed by the cells it skipped.
+   *
+   */
+  struct Cell
+  {
+    char32_t ch = 0;
+    Style style;
+    uint8_t control = 0;      /// Control character without effect on the screen, e.g. BEL, received before the character of the cell
+  };
+
+  // ScreenLine
+  /**
+   * @brief A line of a Screen. Only the cells up to the last written one are stored.
+   *
+   */
+  struct ScreenLine
+  {
+    std::vector<Cell> cells;
+    bool wrapped = false;      /// True if the text continues on the next line because it reached the right margin
+    bool crlf = false;         /// True if the line was ended by a carriage return and a new line, the carriage return being kept in its text
+  };
+
+  // RowRange
+  /**
+   * @brief A range of rows of a Screen, from first included to last excluded.
+   *
+   */
+  struct RowRange
+  {
+    size_t first = 0;
+    size_t last = 0;
+  };
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // Screen
+  /**
+   * @brief Headless model of a VT terminal: a grid of cells with a cursor, the current SGR style, a scroll region and a scrollback of the lines scrolled off the top. Output written to it is interpreted as a terminal would, so that the text a program leaves on the screen can be stored or inspected. Cursor movements are O(1), and scrolling the whole screen is O(1) too.
+   *
+   * @details Supported sequences: CUU, CUD, CUF, CUB, CNL, CPL, CHA, CUP, VPA, ED, EL, IL, DL, ICH, DCH, ECH, SU, SD, DECSTBM, SGR, cursor save and restore (CSI s/u and ESC 7/8), IND, NEL, RI and RIS. A new line also returns the cursor to the first column, as the terminal driver does for the output of a program. Every character takes one cell.
+   *
+   * The text of the lines keeps the bytes which only matter to a file: a tab moves the cursor to the next tab stop but is kept as a tab as long as nothing is written over the cells it skipped, a carriage return just before a new line is kept, and other control characters, e.g. BEL, are kept before the following character.
+   *
+   * The rows changed by the output are tracked, see takeChangedRows, so that a copy of the screen can be updated at a cost proportional to the changes.
+   */
+  class Screen: private AnsiHandler
+  {
+    public:
+    //====================================================
+    //     Constants
+    //====================================================
+
+    static constexpr size_t UNLIMITED = SIZE_MAX;
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit Screen( size_t width = 80, size_t height = 24, size_t max_scrollback = UNLIMITED );
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data );
+    void reset();
+    void takeScrollback( std::string & out );
+    void dropScrollback();
+    RowRange takeChangedRows();
+
+    static void appendLine( std::string & out, const ScreenLine & line, bool styled = false );
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    size_t width() const { return width_; }
+    size_t height() const { return height_; }
+    size_t cursorRow() const { return row_; }
+    size_t cursorCol() const { return col_; }
+    const Style & style() const { return style_; }
+
+    const ScreenLine & line( size_t row ) const { return lines_[ row ]; }
+    const std::deque<ScreenLine> & scrollback() const { return scrollback_; }
+    Cell at( size_t row, size_t col ) const;
+    size_t usedRows() const;
+
+    std::string str() const;
+    std::string str( size_t row ) const;
+    void appendScreen( std::string & out ) const;
+
+    private:
+    //====================================================
+    //     Events
+    //====================================================
+
+    void text( std::string_view run ) override;
+    void control( char code ) override;
+    void csi( const AnsiCsi & csi ) override;
+    void sgr( const Style & style ) override;
+    void esc( char final, char intermediate ) override;
+
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    void put( char32_t ch );
+    void put_ascii( const char * chars, size_t count );
+    void move_to( size_t row, size_t col );
+    void line_feed();
+    void reverse_index();
+    void scroll_up( size_t top, size_t bottom, size_t count, bool to_scrollback );
+    void scroll_down( size_t top, size_t bottom, size_t count );
+    void erase_line( size_t row, size_t first, size_t last );
+    void erase_display( uint32_t mode );
+    void erase_all();
+    void mark_changed( size_t first, size_t last );
+
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    size_t width_, height_, max_scrollback_;
+
+    std::deque<ScreenLine> lines_;
+    std::deque<ScreenLine> scrollback_;
+    std::vector<ScreenLine> spare_;      /// Lines taken from the scrollback, whose storage is reused
+
+    size_t row_, col_;
+    bool wrap_pending_;
+    bool cr_pending_;      /// True if the last event was a carriage return
+    size_t saved_row_, saved_col_;
+    Style saved_style_;
+    size_t top_, bottom_;      /// Scroll region, inclusive
+    RowRange changed_;      /// Rows changed since the last call to takeChangedRows
+
+    Style style_;
+    AnsiParser parser_;
+
+    char32_t utf8_ch_;
+    uint8_t utf8_left_;
+  };
+
+}      // namespace osm
+
+#endif
@@ -0,0 +1,255 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file sink.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_SINK_HPP
+#define OSMANIP_SINK_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <functional>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+#include <stdio.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Forward declarations
+  //====================================================
+
+  class OutputRedirector;
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // Sink
+  /**
+   * @brief Destination of the output of osm::cout, see setSink. The output is passed as it is in the buffer of the stream, without copies: a flush of the stream calls write with the buffered output, then flush.
+   *
+   */
+  class Sink
+  {
+    public:
+    //====================================================
+    //     Destructor
+    //====================================================
+
+    virtual ~Sink() = default;
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    virtual void write( std::string_view data ) = 0;
+    virtual void flush() {}
+  };
+
+  // FdSink
+  /**
+   * @brief Sink writing to a file descriptor, e.g. of a file, a socket or a pipe. Output is collected in a buffer and written with a single system call when the buffer is full or flushed: with writev on POSIX systems, the buffer and the new output are written together without being copied.
+   *
+   */
+  class FdSink: public Sink
+  {
+    public:
+    //====================================================
+    //     Constants
+    //====================================================
+
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit FdSink( int fd, size_t buffer_size = BUFFER_SIZE );
+
+    FdSink( const FdSink & ) = delete;
+    FdSink & operator=( const FdSink & ) = delete;
+
+    //====================================================
+    //     Destructor
+    //====================================================
+
+    ~FdSink() override;
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data ) override;
+    void flush() override;
+
+    int fd() const { return fd_; }
+
+    private:
+    //====================================================
+    //     Private methods
+    //====================================================
+
+    void write_all( std::string_view first, std::string_view second );
+
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    int fd_;
+    size_t buffer_size_;
+    std::string buffer_;
+  };
+
+  // MemorySink
+  /**
+   * @brief Sink collecting the output in memory.
+   *
+   */
+  class MemorySink: public Sink
+  {
+    public:
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data ) override { str_.append( data ); }
+    void clear() { str_.clear(); }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    const std::string & str() const { return str_; }
+
+    private:
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    std::string str_;
+  };
+
+  // PipeSink
+  /**
+   * @brief Sink writing to the standard input of a command, e.g. a pager or a compressor, run by the shell. On POSIX systems SIGPIPE is blocked while the pipe is written, so that writing after the command has exited throws instead of ending the process.
+   *
+   */
+  class PipeSink: public Sink
+  {
+    public:
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit PipeSink( const std::string & command );
+
+    PipeSink( const PipeSink & ) = delete;
+    PipeSink & operator=( const PipeSink & ) = delete;
+
+    //====================================================
+    //     Destructor
+    //====================================================
+
+    ~PipeSink() override;
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data ) override;
+    void flush() override;
+    int close();
+
+    private:
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    FILE * pipe_;
+  };
+
+  // CallbackSink
+  /**
+   * @brief Sink passing the output to user functions, e.g. to feed the I/O layer of an application. The data is only valid during the call.
+   *
+   */
+  class CallbackSink: public Sink
+  {
+    public:
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit CallbackSink( std::function<void( std::string_view )> on_write, std::function<void()> on_flush = {} );
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data ) override;
+    void flush() override;
+
+    private:
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    std::function<void( std::string_view )> on_write_;
+    std::function<void()> on_flush_;
+  };
+
+  // RedirectorSink
+  /**
+   * @brief Sink rendering the output to the file of an OutputRedirector. A flush hands the output over to the redirector, without waiting for an asynchronous one.
+   *
+   */
+  class RedirectorSink: public Sink
+  {
+    public:
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    explicit RedirectorSink( OutputRedirector & redirector );
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    void write( std::string_view data ) override;
+    void flush() override;
+
+    private:
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    OutputRedirector & redirector_;
+  };
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  extern void setSink( Sink * sink );
+  extern Sink * getSink();
+
+}      // namespace osm
+
+#endif
@@ -0,0 +1,220 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file small_string.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_SMALL_STRING_HPP
+#define OSMANIP_SMALL_STRING_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Classes
+  //====================================================
+
+  // SmallString
+  /**
+   * @brief Fixed-capacity, null-terminated string stored inline. It is used to return short escape sequences by value without touching the heap. Content exceeding the capacity is truncated.
+   *
+   * @tparam N The maximum number of characters (excluding the null terminator).
+   */
+  template <size_t N>
+  class SmallString
+  {
+    static_assert( N < 256, "SmallString capacity must fit in a uint8_t." );
+
+    public:
+    //====================================================
+    //     Constructors
+    //====================================================
+
+    constexpr SmallString():
+     data_{},
+     size_( 0 )
+    {
+    }
+
+    SmallString( const char * first, const char * last ):
+     SmallString()
+    {
+      append( first, static_cast<size_t>( last - first ) );
+    }
+
+    SmallString( std::string_view str ):
+     SmallString()
+    {
+      append( str.data(), str.size() );
+    }
+
+    //====================================================
+    //     Methods
+    //====================================================
+
+    // append
+    /**
+     * @brief Appends characters to the string, truncating what does not fit.
+     *
+     * @param str pointer to the characters to be appended.
+     * @param count number of characters to be appended.
+     * @return SmallString& the modified string.
+     */
+    SmallString & append( const char * str, size_t count )
+    {
+      if( count > N - size_ )
+      {
+        count = N - size_;
+      }
+
+      std::memcpy( data_ + size_, str, count );
+      size_ = static_cast<uint8_t>( size_ + count );
+      data_[ size_ ] = '\0';
+
+      return *this;
+    }
+
+    SmallString & append( std::string_view str )
+    {
+      return append( str.data(), str.size() );
+    }
+
+    // clear
+    /**
+     * @brief Empties the string.
+     *
+     */
+    void clear()
+    {
+      size_ = 0;
+      data_[ 0 ] = '\0';
+    }
+
+    //====================================================
+    //     Getters
+    //====================================================
+
+    constexpr const char * data() const { return data_; }
+    constexpr const char * c_str() const { return data_; }
+    constexpr size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+    constexpr const char * begin() const { return data_; }
+    constexpr const char * end() const { return data_ + size_; }
+    static constexpr size_t capacity() { return N; }
+
+    std::string str() const { return std::string( data_, size_ ); }
+
+    //====================================================
+    //     Operators
+    //====================================================
+
+    constexpr operator std::string_view() const { return std::string_view( data_, size_ ); }
+    operator std::string() const { return str(); }
+
+    SmallString & operator+=( std::string_view str ) { return append( str ); }
+
+    private:
+    //====================================================
+    //     Private attributes
+    //====================================================
+
+    char data_[ N + 1 ];
+    uint8_t size_;
+  };
+
+  //====================================================
+  //     Aliases
+  //====================================================
+
+  using esc_string = SmallString<63>;
+
+  //====================================================
+  //     Operators
+  //====================================================
+
+  // operator <<
+  /**
+   * @brief Writes the string into the stream without any intermediate copy.
+   *
+   */
+  template <size_t N>
+  std::ostream & operator<<( std::ostream & os, const SmallString<N> & str )
+  {
+    return os.write( str.data(), static_cast<std::streamsize>( str.size() ) );
+  }
+
+  // operator ==
+  template <size_t N>
+  bool operator==( const SmallString<N> & lhs, std::string_view rhs )
+  {
+    return std::string_view( lhs ) == rhs;
+  }
+
+  template <size_t N>
+  bool operator==( std::string_view lhs, const SmallString<N> & rhs )
+  {
+    return lhs == std::string_view( rhs );
+  }
+
+  template <size_t N>
+  bool operator!=( const SmallString<N> & lhs, std::string_view rhs )
+  {
+    return !( lhs == rhs );
+  }
+
+  template <size_t N>
+  bool operator!=( std::string_view lhs, const SmallString<N> & rhs )
+  {
+    return !( lhs == rhs );
+  }
+
+  // operator +
+  /**
+   * @brief Concatenation with standard strings, so that small strings can be used in the existing string expressions.
+   *
+   */
+  template <size_t N>
+  std::string operator+( const SmallString<N> & lhs, std::string_view rhs )
+  {
+    std::string res;
+    res.reserve( lhs.size() + rhs.size() );
+    res.append( lhs.data(), lhs.size() ).append( rhs.data(), rhs.size() );
+    return res;
+  }
+
+  template <size_t N>
+  std::string operator+( std::string lhs, const SmallString<N> & rhs )
+  {
+    return lhs.append( rhs.data(), rhs.size() );
+  }
+
+  template <size_t N>
+  std::string operator+( const char * lhs, const SmallString<N> & rhs )
+  {
+    return std::string( lhs ) + rhs;
+  }
+
+}      // namespace osm
+
+#endif
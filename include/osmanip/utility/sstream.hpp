@@ -11,6 +11,7 @@
 //====================================================
 //     Preprocessor settings
 //====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
 #pragma once
 #ifndef OSMANIP_MAIN_INCLUDE_UTILITY_SSTREAM_HPP
 #define OSMANIP_MAIN_INCLUDE_UTILITY_SSTREAM_HPP
@@ -27,6 +28,8 @@
 namespace osm
 {
 
+  class Sink;
+
   //====================================================
   //     Classes
   //====================================================
@@ -70,7 +73,7 @@ namespace osm
 
   // Ostreambuf
   /**
-   * @brief This class inherits Stringbuf and adds the ability to send output to a specific std::ostream buffer as well as redirect output to osm::redirout.
+   * @brief This class inherits Stringbuf and adds the ability to send output to a specific std::ostream buffer or Sink as well as redirect output to osm::redirout.
    *
    */
   class Ostreambuf : public Stringbuf
@@ -94,12 +97,15 @@ namespace osm
     //====================================================
 
     void setOstream( std::ostream * ostream );
+    void setSink( Sink * sink );
 
     //====================================================
     //     Getters
     //====================================================
 
     std::ostream * getOstream();
+    Sink * getSink();
+
     //====================================================
     //     Virtual methods
     //====================================================
@@ -112,12 +118,14 @@ namespace osm
     //====================================================
 
     std::ostream * ostream_;
+    Sink * sink_;
 
     //====================================================
     //     Private methods
     //====================================================
 
     void sync_output();
+    int32_t sync_sink();
     void sync_redirection();
   };
 
@@ -0,0 +1,104 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file terminal.hpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Preprocessor settings
+//====================================================
+#include <osmanip/utility/config.hpp>      // Must come first, see config.hpp
+#pragma once
+#ifndef OSMANIP_TERMINAL_HPP
+#define OSMANIP_TERMINAL_HPP
+
+//====================================================
+//     Headers
+//====================================================
+
+// STD headers
+#include <string>
+
+namespace osm
+{
+
+  //====================================================
+  //     Constants
+  //====================================================
+
+  // OUTPUT_ENABLED
+  /**
+   * @brief False if the library is compiled with OSMANIP_DISABLE_OUTPUT (CMake option of the same name). In that case no escape sequence is ever emitted, progress bars and canvases draw nothing and the functions telling whether escapes and colors are enabled become constants, so that the code using them is optimized away while the API stays the same.
+   *
+   */
+#ifdef OSMANIP_DISABLE_OUTPUT
+  inline constexpr bool OUTPUT_ENABLED = false;
+#else
+  inline constexpr bool OUTPUT_ENABLED = true;
+#endif
+
+  //====================================================
+  //     Enum classes
+  //====================================================
+
+  // ESCAPES
+  /**
+   * @brief It is used to store the OPTION function options for the escape sequences emission. Current options are: AUTO to rely on the terminal capabilities, ON to always emit them and OFF to never emit them.
+   *
+   */
+  enum class ESCAPES { AUTO, ON, OFF };
+
+  // COLORDEPTH
+  /**
+   * @brief It is used to choose the palette in which 24-bit colors are encoded: NONE emits nothing, C16 and C256 downsample to the nearest color of the 16 or xterm-256 palettes and TRUECOLOR keeps the exact color.
+   *
+   */
+  enum class COLORDEPTH { NONE, C16, C256, TRUECOLOR };
+
+  //====================================================
+  //     Structs
+  //====================================================
+
+  // TerminalInfo
+  /**
+   * @brief Capabilities of the terminal connected to the standard output.
+   *
+   */
+  struct TerminalInfo
+  {
+    bool is_tty;                  /// Standard output is a terminal (or CLICOLOR_FORCE / FORCE_COLOR are set)
+    bool ansi;                    /// Cursor and control sequences are understood
+    bool color;                   /// Colors and styles are wanted (ansi and NO_COLOR not set)
+    bool unicode;                 /// The terminal encoding is UTF-8
+    COLORDEPTH color_depth;       /// Palette supported according to TERM / COLORTERM
+    std::string term;             /// Value of TERM
+    std::string colorterm;        /// Value of COLORTERM
+  };
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  extern TerminalInfo probe_terminal();
+  extern const TerminalInfo & terminal();
+
+  extern void setEscapes( ESCAPES mode );
+  extern ESCAPES getEscapes();
+
+#ifdef OSMANIP_DISABLE_OUTPUT
+  constexpr bool escapes_enabled() { return false; }
+  constexpr bool colors_enabled() { return false; }
+  constexpr COLORDEPTH color_depth() { return COLORDEPTH::NONE; }
+#else
+  extern bool escapes_enabled();
+  extern bool colors_enabled();
+  extern COLORDEPTH color_depth();
+#endif
+
+}      // namespace osm
+
+#endif
@@ -18,9 +18,15 @@
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/utility/terminal.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/gradient.hpp>
 
 //STD headers
+#include <algorithm>
 #include <sstream>
+#include <stdexcept>
 #include <vector>
 #include <string>
 #include <stdint.h>
@@ -38,7 +44,7 @@ namespace osm
    * @param width Width of the canvas.
    * @param height Height of the canvas.
    */
-  Canvas::Canvas( uint32_t width, uint32_t height ): already_drawn_( false ), width_( width ), height_( height ), bg_char_( ' ' ), bg_feat_( "" ), frame_enabled_( false )
+  OSMANIP_INLINE Canvas::Canvas( uint32_t width, uint32_t height ): frame_enabled_( false ), bg_char_( ' ' ), bg_feat_( "" ), extras_( 1 ), frame_extra_( 0 ), bg_extra_( 0 ), last_extra_( 0 ), already_drawn_( false ), width_( width ), height_( height )
    {
     resizeCanvas();
     clear();
@@ -55,10 +61,26 @@ namespace osm
    * @param c The char that fills the background.
    * @param feat The optional feat.
    */
-  void Canvas::setBackground( char c, const std::string & feat )
+  OSMANIP_INLINE void Canvas::setBackground( char c, const std::string & feat )
    {
     bg_char_ = c;
     bg_feat_ = feat;
+    bg_handle_ = intern( feat );
+    bg_extra_ = addExtra( feat );
+   }
+
+  /**
+   * @brief Set the char that fills the background and its interned style.
+   * 
+   * @param c The char that fills the background.
+   * @param style The style of the background.
+   */
+  OSMANIP_INLINE void Canvas::setBackground( char c, StyleHandle style )
+   {
+    bg_char_ = c;
+    bg_feat_ = style.sequence();
+    bg_handle_ = style;
+    bg_extra_ = 0;
    }
 
   //====================================================
@@ -72,10 +94,26 @@ namespace osm
    * @param fs The FrameStyle of the canvas.
    * @param feat The optional feature.
    */
-  void Canvas::setFrame( FrameStyle fs, const std::string & feat )
+  OSMANIP_INLINE void Canvas::setFrame( FrameStyle fs, const std::string & feat )
    {
     frame_style_ = fs;
     frame_feat_ = feat;
+    frame_handle_ = intern( feat );
+    frame_extra_ = addExtra( feat );
+   }
+
+  /**
+   * @brief Set the FrameStyle of the canvas and its interned style.
+   * 
+   * @param fs The FrameStyle of the canvas.
+   * @param style The style of the frame.
+   */
+  OSMANIP_INLINE void Canvas::setFrame( FrameStyle fs, StyleHandle style )
+   {
+    frame_style_ = fs;
+    frame_feat_ = style.sequence();
+    frame_handle_ = style;
+    frame_extra_ = 0;
    }
 
   // setWidth
@@ -84,7 +122,7 @@ namespace osm
    * 
    * @param width The canvas width to set.
    */
-  void Canvas::setWidth( uint32_t width )
+  OSMANIP_INLINE void Canvas::setWidth( uint32_t width )
    {
     width_ = width;
     resizeCanvas();
@@ -96,7 +134,7 @@ namespace osm
    * 
    * @param height The canvas height to set.
    */
-  void Canvas::setHeight( uint32_t height )
+  OSMANIP_INLINE void Canvas::setHeight( uint32_t height )
    {
     height_ = height;
     resizeCanvas();
@@ -112,7 +150,7 @@ namespace osm
    * 
    * @return uint32_t The width of the canvas.
    */
-  uint32_t Canvas::getWidth() const
+  OSMANIP_INLINE uint32_t Canvas::getWidth() const
    {
     return width_;
    }
@@ -123,7 +161,7 @@ namespace osm
    * 
    * @return uint32_t The height of the canvas.
    */
-  uint32_t Canvas::getHeight() const
+  OSMANIP_INLINE uint32_t Canvas::getHeight() const
    {
     return height_;
    }
@@ -134,7 +172,7 @@ namespace osm
    * 
    * @return char The char that fills the background.
    */
-  char Canvas::getBackground() const
+  OSMANIP_INLINE char Canvas::getBackground() const
    {
     return bg_char_;
    }
@@ -145,7 +183,7 @@ namespace osm
    * 
    * @return const std::string& The optional feat of the background.
    */
-  std::string Canvas::getBackgroundFeat() const
+  OSMANIP_INLINE std::string Canvas::getBackgroundFeat() const
    {
     return bg_feat_;
    }
@@ -156,7 +194,7 @@ namespace osm
    * 
    * @return std::string The frame feature.
    */
-  std::string Canvas::getFrameFeat() const
+  OSMANIP_INLINE std::string Canvas::getFrameFeat() const
    {
     return frame_feat_;
    }
@@ -167,7 +205,7 @@ namespace osm
    * 
    * @return FrameStyle The frame style.
    */
-  FrameStyle Canvas::getFrameStyle() const
+  OSMANIP_INLINE FrameStyle Canvas::getFrameStyle() const
    {
     return frame_style_;
    }
@@ -182,7 +220,7 @@ namespace osm
    * 
    * @param frame_enabled Set to True to enable the frame. Otherwise set to False.
    */
-  void Canvas::enableFrame( bool frame_enabled )
+  OSMANIP_INLINE void Canvas::enableFrame( bool frame_enabled )
    {
     frame_enabled_ = frame_enabled;
    }
@@ -193,7 +231,7 @@ namespace osm
    * 
    * @return bool The frame enabled flag.
    */
-  bool Canvas::isFrameEnabled() const
+  OSMANIP_INLINE bool Canvas::isFrameEnabled() const
    {
     return frame_enabled_;
    }
@@ -202,32 +240,93 @@ namespace osm
   /**
    * @brief Fill the canvas with the background.
    */
-  void Canvas::clear()
+  OSMANIP_INLINE void Canvas::clear()
    {
     char_buffer_.assign( static_cast<int64_t> ( width_ ) * height_, bg_char_ );
-    feat_buffer_.assign( static_cast<int64_t> ( width_ ) * height_, bg_feat_ );
+    style_buffer_.assign( static_cast<int64_t> ( width_ ) * height_, bg_handle_ );
+    if( bg_extra_ != 0 )
+     {
+      extra_buffer_.assign( static_cast<int64_t> ( width_ ) * height_, bg_extra_ );
+     }
+    else
+     {
+      extra_buffer_.clear();
+     }
    }
 
   // put
   /** 
-   * @brief Put a character in the canvas, given its coordinates and an optional feat. An out-of-bounds exception will be thrown if the coordinates are outside the canvas.
+   * @brief Put a character in the canvas, given its coordinates and an optional feat. An out-of-bounds exception will be thrown if the coordinates are outside the canvas. The feat is parsed only when it differs from the one of the previous call, so that drawing with the same feat does not take the lock of the style registry; the StyleHandle overload is still cheaper.
    * 
    * @param c The char to put.
    * @param x The x position.
    * @param y The y position.
    * @param feat The optional feature.
    */
-  void Canvas::put( uint32_t x, uint32_t y, char c, const std::string & feat )
+  OSMANIP_INLINE void Canvas::put( uint32_t x, uint32_t y, char c, const std::string & feat )
+   {
+    if( feat != last_feat_ )
+     {
+      last_handle_ = intern( feat );
+      last_extra_ = addExtra( feat );
+      last_feat_ = feat;
+     }
+
+    put( x, y, c, last_handle_ );
+    setExtra( y * width_ + x, last_extra_ );
+   }
+
+  /** 
+   * @brief Put a character in the canvas, given its coordinates and its interned style. An out-of-bounds exception will be thrown if the coordinates are outside the canvas.
+   * 
+   * @param c The char to put.
+   * @param x The x position.
+   * @param y The y position.
+   * @param style The style of the char.
+   */
+  OSMANIP_INLINE void Canvas::put( uint32_t x, uint32_t y, char c, StyleHandle style )
    {
     char_buffer_.at( y * width_ + x ) = c;
-    feat_buffer_.at( y * width_ + x ) = feat;
+    style_buffer_.at( y * width_ + x ) = style;
+    setExtra( y * width_ + x, 0 );
+   }
+
+  // fillGradient
+  /** 
+   * @brief Fill a rectangle of the canvas with a character colored by a gradient, stretched over its width (or its height, if vertical). The colors come from the lookup table of the gradient, so that this costs as much as a solid fill. An out-of-bounds exception will be thrown if the rectangle is outside the canvas.
+   * 
+   * @param x The x position of the top-left corner.
+   * @param y The y position of the top-left corner.
+   * @param width The width of the rectangle.
+   * @param height The height of the rectangle.
+   * @param c The char to put.
+   * @param gradient The gradient.
+   * @param vertical Set to true to stretch the gradient from the top to the bottom of the rectangle.
+   */
+  OSMANIP_INLINE void Canvas::fillGradient( uint32_t x, uint32_t y, uint32_t width, uint32_t height, char c, const Gradient& gradient, bool vertical )
+   {
+    if( static_cast<uint64_t>( x ) + width > width_ || static_cast<uint64_t>( y ) + height > height_ )
+     {
+      throw std::out_of_range( "The gradient rectangle is outside the canvas!" );
+     }
+
+    for( uint32_t j = 0; j < height; j++ )
+     {
+      const uint64_t row = static_cast<uint64_t>( y + j ) * width_ + x;
+      for( uint32_t i = 0; i < width; i++ )
+       {
+        char_buffer_[ row + i ] = c;
+        style_buffer_[ row + i ] = vertical ? gradient.sample( j, height ) : gradient.sample( i, width );
+        setExtra( static_cast<uint32_t>( row + i ), 0 );
+       }
+     }
    }
 
   // refresh
   /** 
    * @brief Display the canvas in the console.
    */
-  void Canvas::refresh()
+  OSMANIP_INLINE void Canvas::refresh()
    {
     static const std::vector<std::vector<std::string>> frames = 
      {
@@ -237,33 +336,59 @@ namespace osm
       { "\u250c", "\u2500", "\u2510", "\u2502", "\u2502", "\u2514", "\u2500", "\u2518" }
      };
 
-    if( already_drawn_ )
+    if constexpr( ! OUTPUT_ENABLED )
      {
-      for( uint32_t i = 0; i < height_; i++ )
-      {
-        osm::cout << feat( crs, "up", 1 );
-      }
+      return;
+     }
+
+    if( already_drawn_ && height_ > 0 )
+     {
+      cursor_up( osm::cout, static_cast<int32_t>( height_ ) );
      }
 
     uint32_t y = 0;
 
-    const auto& frame = [ & ]( uint32_t fi ) -> std::string 
+    // Features are emitted only if colors are enabled, and only when the handle changes from a cell to the next one
+    const bool colors = colors_enabled();
+    SgrState sgr;
+    StyleHandle current;
+    char sgr_buffer[ SGR_MAX_SIZE ];
+
+    std::stringstream ss;
+
+    const auto& paint = [ & ]( StyleHandle style ) 
      {
-      return frame_feat_ + frames[ frame_style_ ][ fi ] + feat( rst, "all" );
+      if( colors && style != current )
+       {
+        ss.write( sgr_buffer, sgr.apply( sgr_buffer, style.style() ) - sgr_buffer );
+        current = style;
+       }
      };
 
-    std::stringstream ss;
+    const auto& frame = [ & ]( uint32_t fi ) 
+     {
+      paint( frame_handle_ );
+      ss << extras_[ frame_extra_ ] << frames[ frame_style_ ][ fi ];
+     };
+
+    // Lines end with the default style, so that nothing leaks past the canvas
+    const auto& end_line = [ & ]()
+     {
+      paint( StyleHandle() );
+      ss << std::endl;
+     };
 
     if( frame_enabled_ )
      {
-      ss << frame( 0 );
+      frame( 0 );
 
       for( uint32_t i = 2; i < width_; i++ )
        {
-        ss << frame( 1 );
+        frame( 1 );
        }
 
-      ss << frame( 2 ) << std::endl;
+      frame( 2 );
+      end_line();
       y++;
      }
 
@@ -271,14 +396,15 @@ namespace osm
      {
       if( y == height_ - 1 && frame_enabled_ )
       {
-        ss << frame( 5 );
+        frame( 5 );
 
         for( uint32_t i = 2; i < width_; i++ )
          {
-          ss << frame( 6 );
+          frame( 6 );
          }
 
-        ss << frame( 7 ) << std::endl;
+        frame( 7 );
+        end_line();
         continue;
       }
 
@@ -286,23 +412,26 @@ namespace osm
        {
         if( x == 0 && frame_enabled_ )
          {
-          ss << frame( 3 );
+          frame( 3 );
           continue;
          }
 
         if( x == width_ - 1 && frame_enabled_ )
          {
-          ss << frame( 4 );
+          frame( 4 );
           continue;
          }
 
         uint32_t p = y * width_ + x;
 
-        ss << feat_buffer_[ p ]
-           << char_buffer_[ p ]
-           << feat( rst, "all" );
+        paint( style_buffer_[ p ] );
+        if( ! extra_buffer_.empty() )
+         {
+          ss << extras_[ extra_buffer_[ p ] ];
+         }
+        ss << char_buffer_[ p ];
        }
-      ss << std::endl;
+      end_line();
      }
     osm::cout << ss.str();
     already_drawn_ = true;
@@ -312,9 +441,57 @@ namespace osm
   /** 
    * @brief Resize the canvas.
    */
-  void Canvas::resizeCanvas()
+  OSMANIP_INLINE void Canvas::resizeCanvas()
    {
     char_buffer_.resize( static_cast<int64_t> ( width_ ) * height_ );
-    feat_buffer_.resize( static_cast<int64_t> ( width_ ) * height_ );
+    style_buffer_.resize( static_cast<int64_t> ( width_ ) * height_ );
+    if( ! extra_buffer_.empty() )
+     {
+      extra_buffer_.resize( static_cast<int64_t> ( width_ ) * height_ );
+     }
+   }
+
+  // addExtra
+  /** 
+   * @brief Stores the part of a feat which is not made of SGR sequences.
+   * 
+   * @param feat The feat.
+   * @return uint32_t The index of the stored part, 0 if the feat has only SGR sequences.
+   */
+  OSMANIP_INLINE uint32_t Canvas::addExtra( const std::string& feat )
+   {
+    const std::string extra = strip_sgr( feat );
+    if( extra.empty() )
+     {
+      return 0;
+     }
+
+    const auto found = std::find( extras_.begin(), extras_.end(), extra );
+    if( found != extras_.end() )
+     {
+      return static_cast<uint32_t>( found - extras_.begin() );
+     }
+
+    extras_.push_back( extra );
+    return static_cast<uint32_t>( extras_.size() - 1 );
+   }
+
+  // setExtra
+  /** 
+   * @brief Sets the non-SGR part of the feat of a cell. The buffer is only allocated once a feat has such a part.
+   * 
+   * @param p The position of the cell.
+   * @param extra The index of the part, see addExtra.
+   */
+  OSMANIP_INLINE void Canvas::setExtra( uint32_t p, uint32_t extra )
+   {
+    if( extra != 0 && extra_buffer_.empty() )
+     {
+      extra_buffer_.assign( char_buffer_.size(), 0 );
+     }
+    if( ! extra_buffer_.empty() )
+     {
+      extra_buffer_[ p ] = extra;
+     }
    }
  }
\ No newline at end of file
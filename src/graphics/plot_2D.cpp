@@ -32,7 +32,7 @@ namespace osm
    * @param width Width of the canvas.
    * @param height Height of the canvas.
    */
-  Plot2DCanvas::Plot2DCanvas( uint32_t w, uint32_t h ):
+  OSMANIP_INLINE Plot2DCanvas::Plot2DCanvas( uint32_t w, uint32_t h ):
    Canvas( w, h )
     {
      offset_x_ = 0;
@@ -52,7 +52,7 @@ namespace osm
    * @param offset_x The offset_x of the canvas.
    * @param offset_y The offset_y of the canvas.
    */
-  void Plot2DCanvas::setOffset( float xOff, float yOff )
+  OSMANIP_INLINE void Plot2DCanvas::setOffset( float xOff, float yOff )
    {
     offset_x_ = xOff;
     offset_y_ = yOff;
@@ -65,7 +65,7 @@ namespace osm
    * @param scale_x The scale_x of the canvas.
    * @param scale_y The scale_y of the canvas.
    */
-  void Plot2DCanvas::setScale( float xScale, float yScale )
+  OSMANIP_INLINE void Plot2DCanvas::setScale( float xScale, float yScale )
    {
     scale_x_ = xScale;
     scale_y_ = yScale;
@@ -81,7 +81,7 @@ namespace osm
    * 
    * @return The offset_x of the canvas.
    */
-  float Plot2DCanvas::getOffsetX() const
+  OSMANIP_INLINE float Plot2DCanvas::getOffsetX() const
    {
     return offset_x_;
    }
@@ -92,7 +92,7 @@ namespace osm
    * 
    * @return The offset_y of the canvas.
    */
-  float Plot2DCanvas::getOffsetY() const
+  OSMANIP_INLINE float Plot2DCanvas::getOffsetY() const
    {
     return offset_y_;
    }
@@ -103,7 +103,7 @@ namespace osm
    * 
    * @return The scale_x of the canvas.
    */
-  float Plot2DCanvas::getScaleX() const
+  OSMANIP_INLINE float Plot2DCanvas::getScaleX() const
    {
     return scale_x_;
    }
@@ -114,7 +114,7 @@ namespace osm
    * 
    * @return The scale_y of the canvas.
    */
-  float Plot2DCanvas::getScaleY() const
+  OSMANIP_INLINE float Plot2DCanvas::getScaleY() const
    {
     return scale_y_;
    }
@@ -14,11 +14,13 @@
 
 //My headers
 #include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 //STD headers
+#include <array>
+#include <charconv>
 #include <string>
 #include <unordered_map>
-#include <sstream>
 #include <stdint.h>
 
 namespace osm
@@ -32,107 +34,164 @@ namespace osm
    * @brief It is used to store the colors. Note: "bg" is the prefix of the background color features and "bd" is the one of the bold color features.
    * 
    */
-  const std::unordered_map <std::string, std::string> col 
-   {
-    //Error variables:
-    { "error", "Inserted color" },
-  
-    //Color variables:
-    { "black", "\033[30m" },
-    { "red", "\033[31m" },
-    { "green", "\033[32m" },
-    { "orange", "\033[33m" }, 
-    { "blue", "\033[34m" },
-    { "purple", "\033[35m" },
-    { "cyan", "\033[36m" },
-    { "gray", "\033[37m" }, 
-    { "dk gray", "\033[90m" },
-    { "lt red", "\033[91m" }, 
-    { "lt green", "\033[92m" },
-    { "yellow", "\033[93m" },
-    { "lt blue", "\033[94m"},
-    { "lt purple", "\033[95m" },
-    { "lt cyan", "\033[96m" },
-    { "white", "\033[97m" },
-  
-    //Background color variables:
-    { "bg black", "\033[40m" },
-    { "bg red", "\033[41m" },
-    { "bg green", "\033[42m" },
-    { "bg orange", "\033[43m" },
-    { "bg cyan", "\033[44m" },
-    { "bg purple", "\033[45m" },
-    { "bg blue", "\033[46m" },
-    { "bg gray", "\033[47m" },
-    { "bg dk gray", "\033[100m"},
-    { "bg lt red", "\033[101m" },
-    { "bg lt green", "\033[102m" },
-    { "bg yellow", "\033[103m" },
-    { "bg lt blue", "\033[104m"},
-    { "bg lt purple", "\033[105m" },
-    { "bg lt cyan", "\033[106m" },
-    { "bg white", "\033[107m" },
-  
-    //Bold color variables:
-    { "bd black", "\033[1;30m"},
-    { "bd red", "\033[1;31m" },
-    { "bd green", "\033[1;32m" },
-    { "bd orange", "\033[1;33m" }, 
-    { "bd blue", "\033[1;34m" },
-    { "bd purple", "\033[1;35m"},
-    { "bd cyan", "\033[1;36m" },
-    { "bd gray", "\033[1;37m" }
-   };
+  OSMANIP_CONSTINIT OSMANIP_INLINE const feature_map col( col_table );
 
   // sty
   /**
    * @brief It is used to store the styles.
    * 
    */
-  const std::unordered_map <std::string, std::string> sty 
-   {
-    //Error variables:
-    { "error", "Inserted style" },
-  
-    //Style variables:
-    { "bold", "\033[1m" },
-    { "faint", "\033[2m" },
-    { "italics", "\033[3m" },
-    { "underlined", "\033[4m" }, 
-    { "blink", "\033[5m" },
-    { "inverse", "\033[7m" },
-    { "invisible", "\033[8m" },
-    { "crossed", "\033[9m" },
-    { "d-underlined", "\033[21m" }
-   };
+  OSMANIP_CONSTINIT OSMANIP_INLINE const feature_map sty( sty_table );
  
   // rst
   /**
    * @brief It is used to store the reset features commands.
    * 
    */
-  const std::unordered_map <std::string, std::string> rst 
+  OSMANIP_CONSTINIT OSMANIP_INLINE const feature_map rst( rst_table );
+
+  //====================================================
+  //     Palettes
+  //====================================================
+
+  namespace detail
+   {
+    // Levels of the xterm-256 6x6x6 color cube.
+    OSMANIP_STATIC constexpr std::array<uint8_t, 6> cube_levels { 0, 95, 135, 175, 215, 255 };
+
+    // Default xterm values of the 16 basic colors.
+    OSMANIP_STATIC constexpr uint8_t palette_16[ 16 ][ 3 ]
+     {
+      { 0, 0, 0 }, { 205, 0, 0 }, { 0, 205, 0 }, { 205, 205, 0 },
+      { 0, 0, 238 }, { 205, 0, 205 }, { 0, 205, 205 }, { 229, 229, 229 },
+      { 127, 127, 127 }, { 255, 0, 0 }, { 0, 255, 0 }, { 255, 255, 0 },
+      { 92, 92, 255 }, { 255, 0, 255 }, { 0, 255, 255 }, { 255, 255, 255 }
+     };
+
+    // cube_index
+    /**
+     * @brief Lookup table mapping a channel value to the index of the nearest cube level.
+     * 
+     */
+    OSMANIP_STATIC constexpr std::array<uint8_t, 256> cube_index = []
+     {
+      std::array<uint8_t, 256> res {};
+      for( int32_t v = 0; v < 256; v++ )
+       {
+        uint8_t best = 0;
+        for( uint8_t i = 1; i < cube_levels.size(); i++ )
+         {
+          const int32_t d_best = v - cube_levels[ best ], d_i = v - cube_levels[ i ];
+          if( d_i * d_i < d_best * d_best ) best = i;
+         }
+        res[ v ] = best;
+       }
+      return res;
+     }();
+
+    // gray_index
+    /**
+     * @brief Lookup table mapping a gray value to the index (0-23) of the nearest step of the xterm-256 grayscale ramp (8, 18, ..., 238).
+     * 
+     */
+    OSMANIP_STATIC constexpr std::array<uint8_t, 256> gray_index = []
+     {
+      std::array<uint8_t, 256> res {};
+      for( int32_t v = 0; v < 256; v++ )
+       {
+        const int32_t step = ( v - 3 ) / 10;
+        res[ v ] = static_cast<uint8_t>( step < 0 ? 0 : ( step > 23 ? 23 : step ) );
+       }
+      return res;
+     }();
+   }      // namespace detail
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
    {
-    //Error variables:
-    { "error", "Inserted reset command" },
-  
-    //Reset total variables:
-    { "all", "\033[0m" },
-  
-    //Reset color variables:
-    { "color", "\033[39m" },
-    { "bg color", "\033[49m" },
-    { "bd color", "\033[22m \033[39m" },
-  
-    //Reset style variables:
-    { "bd/ft", "\033[22m" },
-    { "italics", "\033[23m" },
-    { "underlined", "\033[24m" },
-    { "blink", "\033[25m" }, 
-    { "inverse", "\033[27m" },
-    { "invisible", "\033[28m" },
-    { "crossed", "\033[29m" },
-   };
+    // square_distance
+    /**
+     * @brief Squared euclidean distance between two colors.
+     * 
+     */
+    OSMANIP_STATIC constexpr int32_t square_distance( int32_t r1, int32_t g1, int32_t b1, int32_t r2, int32_t g2, int32_t b2 )
+     {
+      return ( r1 - r2 ) * ( r1 - r2 ) + ( g1 - g2 ) * ( g1 - g2 ) + ( b1 - b2 ) * ( b1 - b2 );
+     }
+
+    // write_literal
+    /**
+     * @brief Copies a string literal (without its null terminator) into the buffer.
+     * 
+     */
+    template <size_t N>
+    OSMANIP_STATIC char* write_literal( char* out, const char ( &literal )[ N ] )
+     {
+      for( size_t i = 0; i + 1 < N; i++ ) *out++ = literal[ i ];
+      return out;
+     }
+
+    // write_uint8
+    /**
+     * @brief Writes the decimal representation of a byte into the buffer.
+     * 
+     */
+    OSMANIP_STATIC char* write_uint8( char* out, uint8_t value )
+     {
+      if( value >= 100 ) *out++ = static_cast<char>( '0' + value / 100 );
+      if( value >= 10 ) *out++ = static_cast<char>( '0' + value / 10 % 10 );
+      *out++ = static_cast<char>( '0' + value % 10 );
+      return out;
+     }
+
+    // write_color
+    /**
+     * @brief Writes the SGR sequence of a foreground or background color, encoded for the given color depth.
+     * 
+     */
+    OSMANIP_STATIC char* write_color( char* out, uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth, bool background )
+     {
+      switch( depth )
+       {
+        case COLORDEPTH::TRUECOLOR:
+         {
+          out = write_literal( out, "\x1b[" );
+          *out++ = background ? '4' : '3';
+          out = write_literal( out, "8;2;" );
+          out = write_uint8( out, r );
+          *out++ = ';';
+          out = write_uint8( out, g );
+          *out++ = ';';
+          out = write_uint8( out, b );
+          *out++ = 'm';
+          break;
+         }
+        case COLORDEPTH::C256:
+         {
+          out = write_literal( out, "\x1b[" );
+          *out++ = background ? '4' : '3';
+          out = write_literal( out, "8;5;" );
+          out = write_uint8( out, rgb_to_256( r, g, b ) );
+          *out++ = 'm';
+          break;
+         }
+        case COLORDEPTH::C16:
+         {
+          const uint8_t index = rgb_to_16( r, g, b );
+          out = write_literal( out, "\x1b[" );
+          out = write_uint8( out, static_cast<uint8_t>( ( index < 8 ? 30 : 82 ) + ( background ? 10 : 0 ) + index ) );
+          *out++ = 'm';
+          break;
+         }
+        case COLORDEPTH::NONE: break;
+       }
+
+      return out;
+     }
+   }      // namespace detail
 
   //====================================================
   //     Functions
@@ -145,15 +204,166 @@ namespace osm
    * @param r The r singlet of the tripled.
    * @param g The g singlet of the tripled.
    * @param b The b singlet of the tripled.
-   * @return const std::string The rgb triplet of the color.
+   * @return const std::string The rgb triplet of the color, or an empty string if colors are disabled.
+   */
+  OSMANIP_INLINE const std::string RGB( int32_t r, int32_t g, int32_t b )
+   {
+    if( !colors_enabled() )
+     {
+      return {};
+     }
+
+    char buffer[ 48 ];
+    char* out = buffer;
+
+    out = detail::write_literal( out, "\x1b[38;2;" );
+    out = std::to_chars( out, out + 11, r ).ptr;
+    *out++ = ';';
+    out = std::to_chars( out, out + 11, g ).ptr;
+    *out++ = ';';
+    out = std::to_chars( out, out + 11, b ).ptr;
+    *out++ = 'm';
+
+    return std::string( buffer, out );
+   }
+
+  // rgb_to_256
+  /**
+   * @brief Returns the index of the xterm-256 palette color nearest to the given one, choosing between the 6x6x6 color cube and the grayscale ramp.
+   * 
+   * @param r The r singlet of the tripled.
+   * @param g The g singlet of the tripled.
+   * @param b The b singlet of the tripled.
+   * @return uint8_t The palette index.
+   */
+  OSMANIP_INLINE uint8_t rgb_to_256( uint8_t r, uint8_t g, uint8_t b )
+   {
+    const uint8_t ri = detail::cube_index[ r ], gi = detail::cube_index[ g ], bi = detail::cube_index[ b ];
+    const uint8_t gray = detail::gray_index[ ( r + g + b ) / 3 ];
+
+    const int32_t cube_distance = detail::square_distance( r, g, b, detail::cube_levels[ ri ], detail::cube_levels[ gi ], detail::cube_levels[ bi ] );
+    const int32_t gray_level = 8 + 10 * gray;
+    const int32_t gray_distance = detail::square_distance( r, g, b, gray_level, gray_level, gray_level );
+
+    if( gray_distance < cube_distance )
+     {
+      return static_cast<uint8_t>( 232 + gray );
+     }
+    return static_cast<uint8_t>( 16 + 36 * ri + 6 * gi + bi );
+   }
+
+  // rgb_to_16
+  /**
+   * @brief Returns the index (0-7 normal, 8-15 bright) of the 16-color palette color nearest to the given one. The result comes from a table of 4096 entries (4 bits per channel) computed once.
+   * 
+   * @param r The r singlet of the tripled.
+   * @param g The g singlet of the tripled.
+   * @param b The b singlet of the tripled.
+   * @return uint8_t The palette index.
+   */
+  OSMANIP_INLINE uint8_t rgb_to_16( uint8_t r, uint8_t g, uint8_t b )
+   {
+    static const std::array<uint8_t, 4096> table = []
+     {
+      std::array<uint8_t, 4096> res {};
+      for( int32_t i = 0; i < 4096; i++ )
+       {
+        // Each entry represents the center of its quantization cell
+        const int32_t qr = ( ( i >> 8 ) << 4 ) | 8, qg = ( ( ( i >> 4 ) & 15 ) << 4 ) | 8, qb = ( ( i & 15 ) << 4 ) | 8;
+
+        int32_t best = 0, best_distance = INT32_MAX;
+        for( int32_t c = 0; c < 16; c++ )
+         {
+          const int32_t distance = detail::square_distance( qr, qg, qb, detail::palette_16[ c ][ 0 ], detail::palette_16[ c ][ 1 ], detail::palette_16[ c ][ 2 ] );
+          if( distance < best_distance )
+           {
+            best = c;
+            best_distance = distance;
+           }
+         }
+        res[ i ] = static_cast<uint8_t>( best );
+       }
+      return res;
+     }();
+
+    return table[ ( ( r >> 4 ) << 8 ) | ( ( g >> 4 ) << 4 ) | ( b >> 4 ) ];
+   }
+
+  // to_rgb
+  /**
+   * @brief Returns the 24-bit value of a color of the 16-color or xterm-256 palette, with the default xterm values. RGB and default colors are returned unchanged.
+   * 
+   * @param color The color to be converted.
+   * @return Color The RGB color.
+   */
+  OSMANIP_INLINE Color to_rgb( const Color& color )
+   {
+    uint8_t index = color.r;
+    switch( color.type )
+     {
+      case COLORTYPE::BASIC:
+        index &= 15;
+        break;
+      case COLORTYPE::INDEXED:
+        if( index >= 232 )
+         {
+          const uint8_t level = static_cast<uint8_t>( 8 + 10 * ( index - 232 ) );
+          return Color::rgb( level, level, level );
+         }
+        if( index >= 16 )
+         {
+          index -= 16;
+          return Color::rgb( detail::cube_levels[ index / 36 ], detail::cube_levels[ index / 6 % 6 ], detail::cube_levels[ index % 6 ] );
+         }
+        break;
+      default:
+        return color;
+     }
+    return Color::rgb( detail::palette_16[ index ][ 0 ], detail::palette_16[ index ][ 1 ], detail::palette_16[ index ][ 2 ] );
+   }
+
+  // rgb_fg
+  /**
+   * @brief Writes the sequence setting the foreground color, encoded for the given color depth.
+   * 
+   * @param out The output buffer, with room for at least SGR_COLOR_MAX_SIZE characters.
+   * @param r The r singlet of the tripled.
+   * @param g The g singlet of the tripled.
+   * @param b The b singlet of the tripled.
+   * @param depth The color depth to encode for. Default is the one of the terminal (COLORDEPTH::NONE, i.e. nothing is written, if colors are disabled).
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* rgb_fg( char* out, uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth )
+   {
+    return detail::write_color( out, r, g, b, depth, false );
+   }
+
+  // rgb_bg
+  /**
+   * @brief Writes the sequence setting the background color, encoded for the given color depth.
+   * 
+   * @param out The output buffer, with room for at least SGR_COLOR_MAX_SIZE characters.
+   * @param r The r singlet of the tripled.
+   * @param g The g singlet of the tripled.
+   * @param b The b singlet of the tripled.
+   * @param depth The color depth to encode for. Default is the one of the terminal (COLORDEPTH::NONE, i.e. nothing is written, if colors are disabled).
+   * @return char* One past the last written character.
    */
-  const std::string RGB( int32_t r, int32_t g, int32_t b )
+  OSMANIP_INLINE char* rgb_bg( char* out, uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth )
    {
-    static std::ostringstream oss;
-    oss.str( "" );
-    oss.clear();
-    oss << "\x1b[38;2;" << r << ";" << g << ";" << b << "m";
+    return detail::write_color( out, r, g, b, depth, true );
+   }
 
-    return oss.str();
+  // Convenience forms, returning the sequence in a stack-allocated esc_string.
+  OSMANIP_INLINE esc_string rgb_fg( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth )
+   {
+    char buffer[ SGR_COLOR_MAX_SIZE ];
+    return esc_string( buffer, rgb_fg( buffer, r, g, b, depth ) );
+   }
+
+  OSMANIP_INLINE esc_string rgb_bg( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth )
+   {
+    char buffer[ SGR_COLOR_MAX_SIZE ];
+    return esc_string( buffer, rgb_bg( buffer, r, g, b, depth ) );
    }
  }
\ No newline at end of file
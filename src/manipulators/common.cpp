@@ -14,6 +14,7 @@
 
 //My headers
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 //Extra headers
 #include <arsenalgear/utils.hpp>
@@ -21,7 +22,6 @@
 //STD headers
 #include <string>
 #include <unordered_map>
-#include <exception>
 
 namespace osm
  {
@@ -29,23 +29,37 @@ namespace osm
   //     Function
   //====================================================
 
+#ifndef OSMANIP_DISABLE_OUTPUT
+
   // feat (first overload)
   /**
-   * @brief It takes an std::map object as the first argument and an std::string object (map key) as the second argument and returns the interested color / style feature by returning the map value from the corresponding key.
+   * @brief It takes an std::map object as the first argument and an std::string object (map key) as the second argument and returns the interested color / style feature by returning the map value from the corresponding key. An empty string is returned for color / style sequences when colors are disabled and for the other escape sequences when escapes are disabled (see terminal.hpp).
    * 
    * @param generic_map The feature map.
    * @param feat_string The feature name.
    * @return const std::string& The output feature.
    */
-  const std::string& feat( const std::unordered_map <std::string, std::string>& generic_map, const std::string& feat_string )
+  OSMANIP_INLINE const std::string& feat( const std::unordered_map <std::string, std::string>& generic_map, const std::string& feat_string )
    {
-    try
+    static const std::string empty_feat;
+
+    const auto it = generic_map.find( feat_string );
+    if( it == generic_map.end() )
+     {
+      throw agr::except_error_func( generic_map.at( "error" ), feat_string, "is not supported!" );
+     }
+
+    const std::string& sequence = it->second;
+    if( sequence.empty() || sequence.front() != '\033' )
      {
-      return generic_map.at( feat_string );
+      return sequence;
      }
-    catch( const std::exception& except )
+    if( sequence.back() == 'm' )
      {
-      throw agr::except_error_func( generic_map.at( "error" ), feat_string, "is not supported!" );
+      return colors_enabled() ? sequence : empty_feat;
      }
+    return escapes_enabled() ? sequence : empty_feat;
    }
+
+#endif
  }
\ No newline at end of file
@@ -14,6 +14,7 @@
 
 //My headers
 #include <osmanip/manipulators/cursor.hpp>
+#include <osmanip/utility/terminal.hpp>
 
 //Extra headers
 #include <arsenalgear/utils.hpp>
@@ -22,9 +23,10 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
-#include <sstream>
 #include <exception>
 #include <type_traits>
+#include <charconv>
+#include <ostream>
 #include <stdint.h>
 
 namespace osm
@@ -38,55 +40,21 @@ namespace osm
    * @brief It is used to store the cursor commands.
    * 
    */
-  const string_pair_map crs
-   {
-    //Error variables:
-    { "error", std::make_pair( "Inserted cursor command", "" ) },
-  
-    //Cursor variables:
-    { "up", std::make_pair( "\u001b[", "A" ) },
-    { "down", std::make_pair( "\u001b[", "B" ) }, 
-    { "right", std::make_pair( "\u001b[", "C" ) },
-    { "left", std::make_pair( "\u001b[", "D" ) }
-   };
+  OSMANIP_CONSTINIT OSMANIP_INLINE const pair_feature_map crs( crs_table );
 
   // tcs
   /**
    * @brief It is used to store the terminal control sequences.
    * 
    */
-  const std::unordered_map <std::string, std::string> tcs
-   {
-    //Error variables:
-    { "error", "Inserted terminal control sequence" },
-
-    //Control characters variables:
-    { "bell", "\x07" },     //Bell sound
-    { "bksp", "\x08" },     //Backspace
-    { "tab", "\x09" },      //Tab
-    { "lfd", "\x0A" },      //Line feed
-    { "ffd", "\x0C" },      //Form feed
-    { "crt", "\x0D" },      //Carriage return
-
-    //Control sequences variables:
-    { "hcrs", "\u001b[?25l" },      //Hide cursor
-    { "scrs", "\u001b[?25h" }       //Show cursor
-   };
+  OSMANIP_CONSTINIT OSMANIP_INLINE const feature_map tcs( tcs_table );
 
   // tcsc
   /**
    * @brief It is used to store the terminal control sequences for clear line / screen.
    * 
    */
-  const string_pair_map tcsc
-   {
-    //Error variables:
-    { "error", std::make_pair( "Inserted terminal control sequence", "" ) },
-
-    //Control sequences variables:
-    { "csc", std::make_pair( "\u001b[", "J" ) },  //Clear screen (0,1,2)
-    { "cln", std::make_pair( "\u001b[", "K" ) }  //Clear line (0,1,2)
-   };
+  OSMANIP_CONSTINIT OSMANIP_INLINE const pair_feature_map tcsc( tcsc_table );
 
   //====================================================
   //     Functions
@@ -94,28 +62,40 @@ namespace osm
 
   // feat (second overload)
   /**
-   * @brief This overload, with respect to the standard function definition, takes an std::map object as the first argument, but with an std::pair as second type and additionally takes an extra integer argument to correctly set the parameter of the crs map.
+   * @brief This overload, with respect to the standard function definition, takes an std::map object as the first argument, but with an std::pair as second type and additionally takes an extra integer argument to correctly set the parameter of the crs map. The integer is inserted for the crs and tcsc maps and for any other sequence having a final character.
    * 
    * @param generic_map The feature map.
    * @param feat_string The feature name.
    * @param feat_int Extra integer argument to correctly set the parameter of the crs map.
    * @return const std::string The output feature.
    */
-  const std::string feat( const string_pair_map& generic_map, const std::string& feat_string, int32_t feat_int )
+  OSMANIP_INLINE const std::string feat( const string_pair_map& generic_map, const std::string& feat_string, int32_t feat_int )
    {
-    try
+    const auto it = generic_map.find( feat_string );
+    if( it == generic_map.end() )
      {
-      auto it = generic_map.at( feat_string );
-      if( generic_map == crs || generic_map == tcsc )
-       {
-        return it.first + std::to_string( feat_int ) + it.second;
-       }
-      return it.first;
+      throw agr::except_error_func( generic_map.at( "error" ).first, feat_string, "is not supported!" );
      }
-    catch( const std::exception& except )
+
+    // Parametric maps are recognized by address instead of comparing their whole content
+    const auto& [ prefix, suffix ] = it->second;
+    if( !prefix.empty() && prefix.front() == '\033' && !escapes_enabled() )
      {
-      throw agr::except_error_func( generic_map.at( "error" ).first, feat_string, "is not supported!" );
+      return {};
+     }
+    if( &generic_map != &crs.map() && &generic_map != &tcsc.map() && suffix.empty() )
+     {
+      return prefix;
      }
+
+    char number[ 16 ];
+    char* number_end = std::to_chars( number, number + sizeof( number ), feat_int ).ptr;
+
+    std::string res;
+    res.reserve( prefix.size() + ( number_end - number ) + suffix.size() );
+    res.append( prefix ).append( number, number_end ).append( suffix );
+
+    return res;
    }
 
   // go_to
@@ -126,13 +106,264 @@ namespace osm
    * @param y The y position of the cursor in the screen
    * @return const std::string The (x,y) position of the cursor in the screen.
    */
-  const std::string go_to( int32_t x, int32_t y )
-   {
-    std::ostringstream oss;
-    oss.str( "" );
-    oss.clear();
-    oss << "\u001b[" << x << ";" << y << "H";
-    
-    return oss.str();
+  OSMANIP_INLINE const std::string go_to( int32_t x, int32_t y )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return std::string( buffer, cursor_to( buffer, x, y ) );
+   }
+
+  //====================================================
+  //     Helpers
+  //====================================================
+  namespace detail
+   {
+    // write_csi
+    /**
+     * @brief Writes a "ESC[<n><final>" sequence into the buffer.
+     * 
+     * @param out The output buffer.
+     * @param n The numeric parameter.
+     * @param final The final character of the sequence.
+     * @return char* One past the last written character.
+     */
+    OSMANIP_STATIC char* write_csi( char* out, int32_t n, char final )
+     {
+      *out++ = '\x1b';
+      *out++ = '[';
+      out = std::to_chars( out, out + 11, n ).ptr;
+      *out++ = final;
+
+      return out;
+     }
+
+    // write_csi (two parameters)
+    /**
+     * @brief Writes a "ESC[<n>;<m><final>" sequence into the buffer.
+     * 
+     * @param out The output buffer.
+     * @param n The first numeric parameter.
+     * @param m The second numeric parameter.
+     * @param final The final character of the sequence.
+     * @return char* One past the last written character.
+     */
+    OSMANIP_STATIC char* write_csi( char* out, int32_t n, int32_t m, char final )
+     {
+      *out++ = '\x1b';
+      *out++ = '[';
+      out = std::to_chars( out, out + 11, n ).ptr;
+      *out++ = ';';
+      out = std::to_chars( out, out + 11, m ).ptr;
+      *out++ = final;
+
+      return out;
+     }
+
+    // write_to
+    /**
+     * @brief Writes the sequence produced by a buffer writer into a stream, unless escapes are disabled.
+     * 
+     * @param os The output stream.
+     * @param first The beginning of the buffer.
+     * @param last One past the end of the buffer.
+     * @return std::ostream& The output stream.
+     */
+    OSMANIP_STATIC std::ostream& write_to( std::ostream& os, const char* first, const char* last )
+     {
+      if( escapes_enabled() )
+       {
+        os.write( first, last - first );
+       }
+      return os;
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     Buffer writers
+  //====================================================
+
+  // cursor_up
+  /**
+   * @brief Writes the sequence moving the cursor n lines up.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param n The number of lines.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* cursor_up( char* out, int32_t n )
+   {
+    return detail::write_csi( out, n, 'A' );
+   }
+
+  // cursor_down
+  /**
+   * @brief Writes the sequence moving the cursor n lines down.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param n The number of lines.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* cursor_down( char* out, int32_t n )
+   {
+    return detail::write_csi( out, n, 'B' );
+   }
+
+  // cursor_right
+  /**
+   * @brief Writes the sequence moving the cursor n columns right.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param n The number of columns.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* cursor_right( char* out, int32_t n )
+   {
+    return detail::write_csi( out, n, 'C' );
+   }
+
+  // cursor_left
+  /**
+   * @brief Writes the sequence moving the cursor n columns left.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param n The number of columns.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* cursor_left( char* out, int32_t n )
+   {
+    return detail::write_csi( out, n, 'D' );
+   }
+
+  // cursor_to
+  /**
+   * @brief Writes the sequence moving the cursor to the (x,y) position of the screen. The parameters order is the same of go_to.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param x The x position of the cursor in the screen.
+   * @param y The y position of the cursor in the screen.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* cursor_to( char* out, int32_t x, int32_t y )
+   {
+    return detail::write_csi( out, x, y, 'H' );
+   }
+
+  // clear_line
+  /**
+   * @brief Writes the sequence clearing the current line: 0 from the cursor to the end, 1 from the beginning to the cursor and 2 the entire line.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param mode The clear mode.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* clear_line( char* out, int32_t mode )
+   {
+    return detail::write_csi( out, mode, 'K' );
+   }
+
+  // clear_screen
+  /**
+   * @brief Writes the sequence clearing the screen: 0 from the cursor to the end, 1 from the beginning to the cursor, 2 the entire screen and 3 the scrollback too.
+   * 
+   * @param out The output buffer, with room for at least CSI_MAX_SIZE characters.
+   * @param mode The clear mode.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* clear_screen( char* out, int32_t mode )
+   {
+    return detail::write_csi( out, mode, 'J' );
+   }
+
+  //====================================================
+  //     Stream writers
+  //====================================================
+
+  // Each of them formats the sequence on the stack and writes it with a single call. Nothing is written when escapes are disabled.
+  OSMANIP_INLINE std::ostream& cursor_up( std::ostream& os, int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, cursor_up( buffer, n ) );
+   }
+
+  OSMANIP_INLINE std::ostream& cursor_down( std::ostream& os, int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, cursor_down( buffer, n ) );
+   }
+
+  OSMANIP_INLINE std::ostream& cursor_right( std::ostream& os, int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, cursor_right( buffer, n ) );
+   }
+
+  OSMANIP_INLINE std::ostream& cursor_left( std::ostream& os, int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, cursor_left( buffer, n ) );
+   }
+
+  OSMANIP_INLINE std::ostream& cursor_to( std::ostream& os, int32_t x, int32_t y )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, cursor_to( buffer, x, y ) );
+   }
+
+  OSMANIP_INLINE std::ostream& clear_line( std::ostream& os, int32_t mode )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, clear_line( buffer, mode ) );
+   }
+
+  OSMANIP_INLINE std::ostream& clear_screen( std::ostream& os, int32_t mode )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return detail::write_to( os, buffer, clear_screen( buffer, mode ) );
+   }
+
+  //====================================================
+  //     Convenience forms
+  //====================================================
+
+  // Each of them returns the sequence in a stack-allocated esc_string, which is empty when escapes are disabled.
+  OSMANIP_INLINE esc_string cursor_up( int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, cursor_up( buffer, n ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string cursor_down( int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, cursor_down( buffer, n ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string cursor_right( int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, cursor_right( buffer, n ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string cursor_left( int32_t n )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, cursor_left( buffer, n ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string cursor_to( int32_t x, int32_t y )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, cursor_to( buffer, x, y ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string clear_line( int32_t mode )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, clear_line( buffer, mode ) ) : esc_string();
+   }
+
+  OSMANIP_INLINE esc_string clear_screen( int32_t mode )
+   {
+    char buffer[ CSI_MAX_SIZE ];
+    return escapes_enabled() ? esc_string( buffer, clear_screen( buffer, mode ) ) : esc_string();
    }
  }
\ No newline at end of file
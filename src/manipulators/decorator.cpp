@@ -17,13 +17,59 @@
 #include <osmanip/manipulators/decorator.hpp>
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/styled.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+
+//Extra headers
+#include <arsenalgear/utils.hpp>
 
 //STD headers
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <vector>
 
 namespace osm
  {
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // Identifier of the next Decorator, never reused so that settings left in a stream by a destroyed Decorator are never matched again
+    OSMANIP_STATIC std::atomic<uint64_t> next_decorator_id { 1 };
+
+    // Selection
+    /**
+     * @brief Last Decorator whose call operator was used by a thread, and the stream it selected.
+     * 
+     */
+    struct Selection
+     {
+      uint64_t decorator;
+      std::ostream* stream;
+     };
+
+    // selection
+    /**
+     * @brief Returns the selection of the calling thread.
+     * 
+     */
+    OSMANIP_STATIC Selection& selection()
+     {
+      static thread_local Selection selected { 0, nullptr };
+      return selected;
+     }
+   }      // namespace detail
+
   //====================================================
   //     Constructors
   //====================================================
@@ -31,7 +77,22 @@ namespace osm
    * @brief Default constructor of Decorator class.
    * 
    */
-  Decorator::Decorator(){}
+  OSMANIP_INLINE Decorator::Decorator():
+   id( detail::next_decorator_id.fetch_add( 1, std::memory_order_relaxed ) ),
+   current_stream( &osm::cout )
+   {}
+
+  /**
+   * @brief Copy constructor of Decorator class.
+   * 
+   * @param other The copied Decorator.
+   */
+  OSMANIP_INLINE Decorator::Decorator( const Decorator& other ):
+   id( detail::next_decorator_id.fetch_add( 1, std::memory_order_relaxed ) ),
+   current_stream( other.current_stream.load( std::memory_order_relaxed ) )
+   {
+    copySettings( other );
+   }
 
   //====================================================
   //     Destructor
@@ -40,11 +101,32 @@ namespace osm
    * @brief Destructor of Decorator class.
    * 
    */
-  Decorator::~Decorator()
+  OSMANIP_INLINE Decorator::~Decorator()
    {
+    clearSettings();
     osm::cout << feat( rst, "all" );
    }
 
+  //====================================================
+  //     Copy assignment
+  //====================================================
+  /**
+   * @brief Copy assignment operator of Decorator class.
+   * 
+   * @param other The copied Decorator.
+   * @return Decorator& The assigned Decorator.
+   */
+  OSMANIP_INLINE Decorator& Decorator::operator = ( const Decorator& other )
+   {
+    if( this != &other )
+     {
+      clearSettings();
+      copySettings( other );
+      current_stream.store( other.current_stream.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+     }
+    return *this;
+   }
+
   //====================================================
   //     Setters
   //====================================================
@@ -56,10 +138,10 @@ namespace osm
    * @param color The color to be set for the stream.
    * @param os The stream to be modified. Default is osm::cout.
    */
-  void Decorator::setColor( const std::string& color, std::ostream& os )
+  OSMANIP_INLINE void Decorator::setColor( const std::string& color, std::ostream& os )
    {
-    if( colors.count( &os ) == 1 ) colors[ &os ] = color;
-    else colors.insert( { &os, color } );
+    settings( os ).color = color;
+    updatePrefix( os );
    }
 
   // setStyle
@@ -69,10 +151,22 @@ namespace osm
    * @param color The style to be set for the stream.
    * @param os The stream to be modified. Default is osm::cout.
    */
-  void Decorator::setStyle( const std::string& style, std::ostream& os )
+  OSMANIP_INLINE void Decorator::setStyle( const std::string& style, std::ostream& os )
    {
-    if( styles.count( &os ) == 1 ) styles[ &os ] = style;
-    else styles.insert( { &os, style } );
+    settings( os ).styles = style;
+    updatePrefix( os );
+   }
+
+  /**
+   * @brief Method used to set an interned style of a stream, which is combined with its color and its other styles.
+   * 
+   * @param style The handle of the style to be set for the stream.
+   * @param os The stream to be modified. Default is osm::cout.
+   */
+  OSMANIP_INLINE void Decorator::setStyle( StyleHandle style, std::ostream& os )
+   {
+    settings( os ).handle = style;
+    updatePrefix( os );
    }
 
   // resetColor
@@ -82,9 +176,13 @@ namespace osm
    * @param color The color to be reset for the stream.
    * @param os The stream to be modified. Default is osm::cout.
    */
-  void Decorator::resetColor( std::ostream& os )
+  OSMANIP_INLINE void Decorator::resetColor( std::ostream& os )
    {
-    colors.erase( &os );
+    if( DecoratorStyle* settings = find( os ) )
+     {
+      settings -> color.clear();
+      updatePrefix( os );
+     }
    }
 
   // resetStyle
@@ -94,9 +192,14 @@ namespace osm
    * @param color The style to be reset for the stream.
    * @param os The stream to be modified. Default is osm::cout.
    */
-  void Decorator::resetStyle( std::ostream& os )
+  OSMANIP_INLINE void Decorator::resetStyle( std::ostream& os )
    {
-    styles.erase( &os );
+    if( DecoratorStyle* settings = find( os ) )
+     {
+      settings -> styles.clear();
+      settings -> handle = StyleHandle();
+      updatePrefix( os );
+     }
    }
 
   // removeStyle
@@ -105,17 +208,23 @@ namespace osm
    * 
    * @param color The style to be reset for the stream.
    * @param os The stream to be modified. Default is osm::cout.
+   * @throws std::out_of_range if no style is set for the stream or the style is not among them.
    */
-  void Decorator::removeStyle( const std::string& style, std::ostream& os )
+  OSMANIP_INLINE void Decorator::removeStyle( const std::string& style, std::ostream& os )
    {
-    std::string str_mod = styles.at( &os );
-    std::string::size_type sub_str = str_mod.find( style );
+    DecoratorStyle* settings = find( os );
+    if( settings == nullptr )
+     {
+      throw std::out_of_range( "No style is set for the stream!" );
+     }
 
-    styles.at( &os ) = str_mod.erase( sub_str, style.length() );
+    std::string& str_mod = settings -> styles;
+    str_mod.erase( str_mod.find( style ), style.length() );
 
-    if ( getStyleList()[ &os ][0] == ' ' ) styles.at( &os ).erase( 0, 1 );
-    else if ( getStyleList()[ &os ].back() == ' ' ) styles.at( &os ).pop_back();
+    if ( ! str_mod.empty() && str_mod[0] == ' ' ) str_mod.erase( 0, 1 );
+    else if ( ! str_mod.empty() && str_mod.back() == ' ' ) str_mod.pop_back();
 
+    updatePrefix( os );
    }
 
   // resetFeatures
@@ -124,10 +233,15 @@ namespace osm
    * 
    * @param os The stream to be modified. Default is osm::cout.
    */
-  void Decorator::resetFeatures( std::ostream& os )
+  OSMANIP_INLINE void Decorator::resetFeatures( std::ostream& os )
    {
-    colors.erase( &os );
-    styles.erase( &os );
+    if( DecoratorStyle* settings = find( os ) )
+     {
+      settings -> color.clear();
+      settings -> styles.clear();
+      settings -> handle = StyleHandle();
+      updatePrefix( os );
+     }
     os << feat( rst, "all" );
    }
 
@@ -143,9 +257,10 @@ namespace osm
    * 
    * @return std::string The current color of the stream.
    */
-  std::string Decorator::getColor( std::ostream& os )
+  OSMANIP_INLINE std::string Decorator::getColor( std::ostream& os )
    {
-    return colors[ &os ];
+    const DecoratorStyle* settings = find( os );
+    return settings == nullptr ? std::string() : settings -> color;
    }
 
   // getStyle
@@ -156,42 +271,254 @@ namespace osm
    * 
    * @return std::string The current style of the stream.
    */
-  std::string Decorator::getStyle( std::ostream& os )
+  OSMANIP_INLINE std::string Decorator::getStyle( std::ostream& os )
    {
-    return styles[ &os ];
+    const DecoratorStyle* settings = find( os );
+    return settings == nullptr ? std::string() : settings -> styles;
+   }
+
+  // getStyleHandle
+  /**
+   * @brief Method used to return the interned style of a stream.
+   * 
+   * @param os The stream which interned style is returned. Default is osm::cout.
+   * 
+   * @return StyleHandle The interned style of the stream, the default one if not set.
+   */
+  OSMANIP_INLINE StyleHandle Decorator::getStyleHandle( std::ostream& os ) const
+   {
+    const DecoratorStyle* settings = find( os );
+    return settings == nullptr ? StyleHandle() : settings -> handle;
    }
 
   // getColorList
   /**
-   * @brief Method used to return the map of streams with the respective color.
+   * @brief Method used to return the map of streams with the respective color. Only the streams which still exist are listed.
    * 
    * @return std::map <std::ostream*, std::string> The stream-color map.
    */
-  std::unordered_map <std::ostream*, std::string> Decorator::getColorList()
+  OSMANIP_INLINE std::unordered_map <std::ostream*, std::string> Decorator::getColorList()
    {
+    std::unordered_map <std::ostream*, std::string> colors;
+    std::lock_guard<std::mutex> lock( streams_mutex );
+    for( const Tracked& tracked: streams )
+     {
+      const DecoratorStyle* settings = tracked.alive.expired() ? nullptr : find( *tracked.stream );
+      if( settings != nullptr && ! settings -> color.empty() ) colors.emplace( tracked.stream, settings -> color );
+     }
     return colors;
    }
 
   // getStyleList
   /**
-   * @brief Method used to return the map of streams with the respective style.
+   * @brief Method used to return the map of streams with the respective style. Only the streams which still exist are listed.
    * 
    * @return std::map <std::ostream*, std::string> The stream-color map.
    */
-  std::unordered_map <std::ostream*, std::string> Decorator::getStyleList()
+  OSMANIP_INLINE std::unordered_map <std::ostream*, std::string> Decorator::getStyleList()
    {
+    std::unordered_map <std::ostream*, std::string> styles;
+    std::lock_guard<std::mutex> lock( streams_mutex );
+    for( const Tracked& tracked: streams )
+     {
+      const DecoratorStyle* settings = tracked.alive.expired() ? nullptr : find( *tracked.stream );
+      if( settings != nullptr && ! settings -> styles.empty() ) styles.emplace( tracked.stream, settings -> styles );
+     }
     return styles;
    }
 
   // getCurrentStream
   /**
-   * @brief Method used to return the stream that is used to output stuff.
+   * @brief Method used to return the stream that is used to output stuff, i.e. the last one selected with the call operator by the calling thread, or by any thread if the calling one never did.
    * 
    * @return std::ostream& The used stream to output stuff.
    */
-  std::ostream& Decorator::getCurrentStream()
+  OSMANIP_INLINE std::ostream& Decorator::getCurrentStream() const
+   {
+    const detail::Selection& selected = detail::selection();
+    if( selected.decorator == id )
+     {
+      return *selected.stream;
+     }
+    return *current_stream.load( std::memory_order_relaxed );
+   }
+
+  // getPrefix
+  /**
+   * @brief Method used to return the precompiled sequence of the color and the styles of a stream. If any of them is not supported, the corresponding error is thrown.
+   * 
+   * @param os The stream which prefix is returned. Default is osm::cout.
+   * 
+   * @return const esc_string& The prefix of the stream, empty if no feature is set.
+   */
+  OSMANIP_INLINE const esc_string& Decorator::getPrefix( std::ostream& os ) const
+   {
+    static const esc_string empty;
+
+    const DecoratorStyle* settings = find( os );
+    if( settings == nullptr )
+     {
+      return empty;
+     }
+
+    if( ! settings -> valid )
+     {
+      // Let feat throw the error of the unsupported feature
+      if( ! settings -> color.empty() ) feat( col, settings -> color );
+      for( const auto& elem: agr::split_string( settings -> styles, " " ) ) feat( sty, elem );
+     }
+
+    return settings -> prefix;
+   }
+
+  //====================================================
+  //     Private methods
+  //====================================================
+
+  // find
+  /**
+   * @brief Method used to find the settings of the Decorator in the StreamStyle of a stream.
+   * 
+   * @param os The stream.
+   * @return DecoratorStyle* The settings, or nullptr if the Decorator has none for the stream.
+   */
+  OSMANIP_INLINE DecoratorStyle* Decorator::find( std::ostream& os ) const
+   {
+    StreamStyle* state = find_stream_style( os );
+    if( state == nullptr )
+     {
+      return nullptr;
+     }
+
+    for( DecoratorStyle& settings: state -> decorators )
+     {
+      if( settings.owner == id ) return &settings;
+     }
+    return nullptr;
+   }
+
+  // settings
+  /**
+   * @brief Method used to return the settings of the Decorator for a stream, adding them to the StreamStyle of the stream and watching the stream if needed.
+   * 
+   * @param os The stream.
+   * @return DecoratorStyle& The settings.
+   */
+  OSMANIP_INLINE DecoratorStyle& Decorator::settings( std::ostream& os )
+   {
+    if( DecoratorStyle* settings = find( os ) )
+     {
+      return *settings;
+     }
+
+    StreamStyle& state = stream_style( os );
+    if( ! state.alive )
+     {
+      state.alive = std::make_shared<char>();
+     }
+
+    {
+     std::lock_guard<std::mutex> lock( streams_mutex );
+     streams.erase( std::remove_if( streams.begin(), streams.end(), [ &os ]( const Tracked& tracked ) { return tracked.stream == &os || tracked.alive.expired(); } ), streams.end() );
+     streams.push_back( Tracked{ &os, state.alive } );
+    }
+
+    state.decorators.push_back( DecoratorStyle{ id, {}, {}, {}, {}, true } );
+    return state.decorators.back();
+   }
+
+  // updatePrefix
+  /**
+   * @brief Method used to precompile the combined sequence of the color and the styles of a stream, so that insertions don't need any lookup. Features are searched in the constant tables, independently of whether colors are enabled. Settings left without any feature are removed from the stream.
+   * 
+   * @param os The stream which prefix is updated.
+   */
+  OSMANIP_INLINE void Decorator::updatePrefix( std::ostream& os )
+   {
+    DecoratorStyle* settings = find( os );
+    if( settings == nullptr )
+     {
+      return;
+     }
+
+    if( settings -> color.empty() && settings -> styles.empty() && settings -> handle.isDefault() )
+     {
+      std::vector<DecoratorStyle>& decorators = find_stream_style( os ) -> decorators;
+      decorators.erase( decorators.begin() + ( settings - decorators.data() ) );
+      return;
+     }
+
+    Style style;
+    bool valid = true;
+
+    if( ! settings -> color.empty() )
+     {
+      const std::string_view sequence = find_feature_in( col_table, settings -> color );
+      valid = ! sequence.empty();
+      style = parse_sgr( sequence, style );
+     }
+
+    if( ! settings -> styles.empty() )
+     {
+      for( const auto& elem: agr::split_string( settings -> styles, " " ) )
+       {
+        const std::string_view sequence = find_feature_in( sty_table, elem );
+        valid = valid && ! sequence.empty();
+        style = parse_sgr( sequence, style );
+       }
+     }
+
+    style = style | settings -> handle.style();
+
+    char buffer[ SGR_MAX_SIZE ];
+    settings -> prefix = style.isDefault() ? esc_string() : esc_string( buffer, write_sgr( buffer, Style{}, style ) );
+    settings -> valid = valid;
+   }
+
+  // copySettings
+  /**
+   * @brief Method used to copy the settings of another Decorator for the streams which still exist.
+   * 
+   * @param other The copied Decorator.
+   */
+  OSMANIP_INLINE void Decorator::copySettings( const Decorator& other )
+   {
+    std::vector<Tracked> others;
+    {
+     std::lock_guard<std::mutex> lock( other.streams_mutex );
+     others = other.streams;
+    }
+
+    for( const Tracked& tracked: others )
+     {
+      const DecoratorStyle* source = tracked.alive.expired() ? nullptr : other.find( *tracked.stream );
+      if( source != nullptr )
+       {
+        const DecoratorStyle copy = *source;
+        DecoratorStyle& settings = this -> settings( *tracked.stream );
+        settings = copy;
+        settings.owner = id;
+       }
+     }
+   }
+
+  // clearSettings
+  /**
+   * @brief Method used to remove the settings of the Decorator from the streams which still exist.
+   * 
+   */
+  OSMANIP_INLINE void Decorator::clearSettings()
    {
-    return *current_stream;
+    std::lock_guard<std::mutex> lock( streams_mutex );
+    for( const Tracked& tracked: streams )
+     {
+      StreamStyle* state = tracked.alive.expired() ? nullptr : find_stream_style( *tracked.stream );
+      if( state != nullptr )
+       {
+        state -> decorators.erase( std::remove_if( state -> decorators.begin(), state -> decorators.end(), [ this ]( const DecoratorStyle& settings ) { return settings.owner == id; } ), state -> decorators.end() );
+       }
+     }
+    streams.clear();
    }
 
   //====================================================
@@ -200,14 +527,15 @@ namespace osm
 
   // operator ()
   /**
-   * @brief Operator overload to assign the value into parentheses to the "current_stream" variable.
+   * @brief Operator overload to assign the value into parentheses to the "current_stream" variable. The stream is also selected for the calling thread only, so that the following insertion goes to it even if other threads select other streams meanwhile.
    * 
    * @param os Input value, i.e. the stream put into parentheses.
-   * @return const Decorator& The class pointer.
+   * @return const Decorator& The Decorator itself.
    */
-  const Decorator& Decorator::operator () ( std::ostream& os )
+  OSMANIP_INLINE const Decorator& Decorator::operator () ( std::ostream& os )
    {
-    current_stream = &os;
+    current_stream.store( &os, std::memory_order_relaxed );
+    detail::selection() = detail::Selection{ id, &os };
     return *this;
    }
  }
\ No newline at end of file
@@ -0,0 +1,159 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file gradient.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/gradient.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+
+//STD headers
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // lerp
+    /**
+     * @brief Interpolates a channel, rounding to the nearest value.
+     *
+     */
+    OSMANIP_STATIC uint8_t lerp( uint8_t from, uint8_t to, double t )
+     {
+      return static_cast<uint8_t>( from + ( to - from ) * t + 0.5 );
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     Gradient methods
+  //====================================================
+
+  // Constructors
+  /**
+   * @brief Builds the lookup table of the gradient.
+   *
+   * @param stops The RGB colors the gradient goes through, evenly spaced. There must be at least one.
+   * @param steps The size of the lookup table.
+   * @param background Set to true to color the background instead of the foreground.
+   * @param depth The color depth of the table, by default the one of the terminal.
+   */
+  OSMANIP_INLINE Gradient::Gradient( std::initializer_list<Color> stops, size_t steps, bool background, COLORDEPTH depth ):
+   Gradient( std::vector<Color>( stops ), steps, background, depth )
+   {}
+
+  OSMANIP_INLINE Gradient::Gradient( const std::vector<Color>& stops, size_t steps, bool background, COLORDEPTH depth )
+   {
+    if( stops.empty() )
+     {
+      throw std::invalid_argument( "A gradient needs at least one color!" );
+     }
+
+    for( const auto& stop: stops )
+     {
+      if( stop.type != COLORTYPE::RGB ) throw std::invalid_argument( "Gradient colors must be RGB colors!" );
+     }
+
+    table_.reserve( steps );
+    for( size_t i = 0; i < steps; i++ )
+     {
+      // Position in units of stops
+      const double position = steps > 1 ? static_cast<double>( i ) * ( stops.size() - 1 ) / ( steps - 1 ) : 0.0;
+      const size_t stop = position >= stops.size() - 1 ? stops.size() - 1 : static_cast<size_t>( position );
+      const Color& from = stops[ stop ];
+      const Color& to = stops[ stop + 1 < stops.size() ? stop + 1 : stop ];
+      const double t = position - stop;
+
+      const Color color = color_at_depth( detail::lerp( from.r, to.r, t ), detail::lerp( from.g, to.g, t ), detail::lerp( from.b, to.b, t ), depth );
+      table_.push_back( intern( background ? Style{ {}, color, ATTR::NONE } : Style{ color, {}, ATTR::NONE } ) );
+     }
+   }
+
+  // sample
+  /**
+   * @brief Returns the color of a cell, when the gradient is stretched over a given number of cells.
+   *
+   * @param index The index of the cell. Indexes past the last cell are clamped.
+   * @param count The number of cells.
+   * @return StyleHandle The style of the cell, the default one if the gradient is empty.
+   */
+  OSMANIP_INLINE StyleHandle Gradient::sample( size_t index, size_t count ) const
+   {
+    if( table_.empty() )
+     {
+      return StyleHandle();
+     }
+
+    if( count < 2 )
+     {
+      return table_.front();
+     }
+
+    if( index >= count ) index = count - 1;
+    return table_[ index * ( table_.size() - 1 ) / ( count - 1 ) ];
+   }
+
+  /**
+   * @brief Returns the color at a position of the gradient, e.g. to color a heatmap.
+   *
+   * @param fraction The position, from 0 to 1. Values out of range are clamped.
+   * @return StyleHandle The style at the position, the default one if the gradient is empty.
+   */
+  OSMANIP_INLINE StyleHandle Gradient::sample( double fraction ) const
+   {
+    if( table_.empty() )
+     {
+      return StyleHandle();
+     }
+
+    if( ! ( fraction > 0.0 ) ) return table_.front();
+    if( fraction >= 1.0 ) return table_.back();
+
+    return table_[ static_cast<size_t>( fraction * ( table_.size() - 1 ) + 0.5 ) ];
+   }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // color_at_depth
+  /**
+   * @brief Converts an RGB color to the nearest one available at a color depth.
+   *
+   * @param r The r singlet of the tripled.
+   * @param g The g singlet of the tripled.
+   * @param b The b singlet of the tripled.
+   * @param depth The color depth.
+   * @return Color The converted color, the default one if the depth is NONE.
+   */
+  OSMANIP_INLINE Color color_at_depth( uint8_t r, uint8_t g, uint8_t b, COLORDEPTH depth )
+   {
+    switch( depth )
+     {
+      case COLORDEPTH::TRUECOLOR: return Color::rgb( r, g, b );
+      case COLORDEPTH::C256: return Color::indexed( rgb_to_256( r, g, b ) );
+      case COLORDEPTH::C16: return Color::basic( rgb_to_16( r, g, b ) );
+      case COLORDEPTH::NONE: break;
+     }
+    return Color();
+   }
+ }
@@ -0,0 +1,308 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file printer.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/printer.hpp>
+#include <osmanip/utility/display_width.hpp>
+
+//STD headers
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Variables
+  //====================================================
+
+  namespace detail
+   {
+    // print_buffer_in_use
+    /**
+     * @brief Tells whether the per-thread buffer of print is already used by an outer call.
+     *
+     */
+    OSMANIP_STATIC thread_local bool print_buffer_in_use = false;
+   }      // namespace detail
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // thread_buffer
+    /**
+     * @brief Returns the per-thread buffer of print, which keeps its capacity between calls.
+     *
+     */
+    OSMANIP_STATIC std::string& thread_buffer()
+     {
+      static thread_local std::string buffer;
+      return buffer;
+     }
+
+    // pad
+    /**
+     * @brief Pads the text written from "begin" to the end of the buffer up to the width of the specification. Zero padding goes after the sign. Strings are measured in terminal cells, so that columns of wide or styled text stay aligned.
+     *
+     */
+    OSMANIP_STATIC void pad( std::string& out, size_t begin, const FormatSpec& spec, char default_align, bool numeric )
+     {
+      const size_t size = numeric ? out.size() - begin : display_width( std::string_view( out ).substr( begin ) );
+      if( spec.width <= size )
+       {
+        return;
+       }
+
+      const size_t count = spec.width - size;
+
+      if( numeric && spec.zero && spec.align == '\0' )
+       {
+        size_t position = begin;
+        if( position < out.size() && ( out[ position ] == '-' || out[ position ] == '+' || out[ position ] == ' ' ) ) position++;
+        out.insert( position, count, '0' );
+        return;
+       }
+
+      switch( spec.align ? spec.align : default_align )
+       {
+        case '<': out.append( count, spec.fill ); break;
+        case '>': out.insert( begin, count, spec.fill ); break;
+        default:
+         {
+          out.insert( begin, count / 2, spec.fill );
+          out.append( count - count / 2, spec.fill );
+         }
+       }
+     }
+
+    // write_sign
+    /**
+     * @brief Writes the sign of a non-negative number, if requested by the specification.
+     *
+     */
+    OSMANIP_STATIC void write_sign( std::string& out, const FormatSpec& spec )
+     {
+      if( spec.sign == '+' || spec.sign == ' ' ) out.push_back( spec.sign );
+     }
+
+    // write_unsigned
+    /**
+     * @brief Writes an unsigned integer in the base of the specification type.
+     *
+     */
+    OSMANIP_STATIC void write_unsigned( std::string& out, uint64_t value, const FormatSpec& spec )
+     {
+      int32_t base = 10;
+      switch( spec.type )
+       {
+        case 'x': case 'X': base = 16; break;
+        case 'o': base = 8; break;
+        case 'b': base = 2; break;
+        default: break;
+       }
+
+      char buffer[ 64 ];
+      char* last = std::to_chars( buffer, buffer + sizeof( buffer ), value, base ).ptr;
+
+      if( spec.type == 'X' )
+       {
+        for( char* c = buffer; c != last; c++ ) *c = static_cast<char>( std::toupper( static_cast<unsigned char>( *c ) ) );
+       }
+
+      out.append( buffer, last );
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     PrintBuffer methods
+  //====================================================
+
+  // Default constructor
+  /**
+   * @brief Takes the per-thread buffer, or a local one if an outer print is using it.
+   *
+   */
+  OSMANIP_INLINE PrintBuffer::PrintBuffer():
+   str_( detail::print_buffer_in_use ? &local_ : &detail::thread_buffer() )
+   {
+    if( str_ != &local_ )
+     {
+      detail::print_buffer_in_use = true;
+      str_ -> clear();
+     }
+   }
+
+  // Destructor
+  /**
+   * @brief Gives the per-thread buffer back.
+   *
+   */
+  OSMANIP_INLINE PrintBuffer::~PrintBuffer()
+   {
+    if( str_ != &local_ )
+     {
+      detail::print_buffer_in_use = false;
+     }
+   }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // format_value
+  /**
+   * @brief Appends a signed integer. With the "c" type the value is written as a character.
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, int64_t value, const FormatSpec& spec )
+   {
+    if( spec.type == 'c' )
+     {
+      format_value( out, static_cast<char>( value ), spec );
+      return;
+     }
+
+    const size_t begin = out.size();
+
+    if( value < 0 ) out.push_back( '-' );
+    else detail::write_sign( out, spec );
+
+    detail::write_unsigned( out, value < 0 ? 0 - static_cast<uint64_t>( value ) : static_cast<uint64_t>( value ), spec );
+    detail::pad( out, begin, spec, '>', true );
+   }
+
+  /**
+   * @brief Appends an unsigned integer. With the "c" type the value is written as a character.
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, uint64_t value, const FormatSpec& spec )
+   {
+    if( spec.type == 'c' )
+     {
+      format_value( out, static_cast<char>( value ), spec );
+      return;
+     }
+
+    const size_t begin = out.size();
+
+    detail::write_sign( out, spec );
+    detail::write_unsigned( out, value, spec );
+    detail::pad( out, begin, spec, '>', true );
+   }
+
+  /**
+   * @brief Appends a floating point. Without type and precision it is written as the standard streams do (i.e. %g).
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, double value, const FormatSpec& spec )
+   {
+    char format[ 8 ] = { '%' };
+    size_t size = 1;
+    if( spec.sign == '+' || spec.sign == ' ' ) format[ size++ ] = spec.sign;
+    format[ size++ ] = '.';
+    format[ size++ ] = '*';
+    format[ size++ ] = ( spec.type && std::string_view( "fFeEgG" ).find( spec.type ) != std::string_view::npos ) ? spec.type : 'g';
+    format[ size ] = '\0';
+
+    const int32_t precision = spec.precision >= 0 ? spec.precision : 6;
+    const size_t begin = out.size();
+
+    char buffer[ 128 ];
+    const int32_t length = std::snprintf( buffer, sizeof( buffer ), format, precision, value );
+
+    if( length > 0 && static_cast<size_t>( length ) < sizeof( buffer ) )
+     {
+      out.append( buffer, static_cast<size_t>( length ) );
+     }
+    else if( length > 0 )
+     {
+      out.resize( begin + static_cast<size_t>( length ) + 1 );
+      std::snprintf( &out[ begin ], static_cast<size_t>( length ) + 1, format, precision, value );
+      out.resize( begin + static_cast<size_t>( length ) );
+     }
+
+    detail::pad( out, begin, spec, '>', true );
+   }
+
+  /**
+   * @brief Appends a string. The precision, if any, is the maximum number of characters written.
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, std::string_view value, const FormatSpec& spec )
+   {
+    const size_t begin = out.size();
+
+    if( spec.precision >= 0 && value.size() > static_cast<size_t>( spec.precision ) )
+     {
+      value = value.substr( 0, static_cast<size_t>( spec.precision ) );
+     }
+
+    out.append( value.data(), value.size() );
+    detail::pad( out, begin, spec, '<', false );
+   }
+
+  /**
+   * @brief Appends a boolean as "true" or "false", or as an integer with an integer type.
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, bool value, const FormatSpec& spec )
+   {
+    if( spec.type && spec.type != 's' )
+     {
+      format_value( out, static_cast<uint64_t>( value ), spec );
+      return;
+     }
+
+    format_value( out, std::string_view( value ? "true" : "false" ), spec );
+   }
+
+  /**
+   * @brief Appends a character, or its code with an integer type.
+   *
+   * @param out The buffer.
+   * @param value The value.
+   * @param spec The format specification.
+   */
+  OSMANIP_INLINE void format_value( std::string& out, char value, const FormatSpec& spec )
+   {
+    if( spec.type && spec.type != 'c' )
+     {
+      format_value( out, static_cast<int64_t>( value ), spec );
+      return;
+     }
+
+    format_value( out, std::string_view( &value, 1 ), spec );
+   }
+ }
@@ -0,0 +1,428 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file sgr.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+//STD headers
+#include <charconv>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Tables
+  //====================================================
+
+  namespace detail
+   {
+    // AttrCode
+    /**
+     * @brief SGR code of a set of attributes.
+     *
+     */
+    struct AttrCode
+     {
+      ATTR attrs;
+      uint8_t code;
+     };
+
+    // attr_on
+    /**
+     * @brief SGR codes which turn each attribute on.
+     *
+     */
+    OSMANIP_STATIC constexpr AttrCode attr_on[]
+     {
+      { ATTR::BOLD, 1 }, { ATTR::FAINT, 2 }, { ATTR::ITALICS, 3 }, { ATTR::UNDERLINED, 4 }, { ATTR::BLINK, 5 },
+      { ATTR::INVERSE, 7 }, { ATTR::INVISIBLE, 8 }, { ATTR::CROSSED, 9 }, { ATTR::D_UNDERLINED, 21 }
+     };
+
+    // attr_off
+    /**
+     * @brief SGR codes which turn attributes off. Note that bold and faint, as well as the two underlines, are turned off together.
+     *
+     */
+    OSMANIP_STATIC constexpr AttrCode attr_off[]
+     {
+      { ATTR::BOLD | ATTR::FAINT, 22 }, { ATTR::ITALICS, 23 }, { ATTR::UNDERLINED | ATTR::D_UNDERLINED, 24 },
+      { ATTR::BLINK, 25 }, { ATTR::INVERSE, 27 }, { ATTR::INVISIBLE, 28 }, { ATTR::CROSSED, 29 }
+     };
+   }      // namespace detail
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // write_code
+    /**
+     * @brief Writes a parameter followed by the ";" separator.
+     *
+     */
+    OSMANIP_STATIC char* write_code( char* out, uint32_t code )
+     {
+      out = std::to_chars( out, out + 10, code ).ptr;
+      *out++ = ';';
+      return out;
+     }
+
+    // write_color_codes
+    /**
+     * @brief Writes the parameters selecting a foreground or background color.
+     *
+     */
+    OSMANIP_STATIC char* write_color_codes( char* out, const Color& color, bool background )
+     {
+      const uint32_t offset = background ? 10 : 0;
+
+      switch( color.type )
+       {
+        case COLORTYPE::DEFAULT: return write_code( out, 39 + offset );
+        case COLORTYPE::BASIC: return write_code( out, ( color.r < 8 ? 30 : 82 ) + offset + color.r );
+        case COLORTYPE::INDEXED:
+         {
+          out = write_code( out, 38 + offset );
+          out = write_code( out, 5 );
+          return write_code( out, color.r );
+         }
+        case COLORTYPE::RGB:
+         {
+          out = write_code( out, 38 + offset );
+          out = write_code( out, 2 );
+          out = write_code( out, color.r );
+          out = write_code( out, color.g );
+          return write_code( out, color.b );
+         }
+       }
+
+      return out;
+     }
+
+    // write_attrs_on
+    /**
+     * @brief Writes the parameters which turn the given attributes on.
+     *
+     */
+    OSMANIP_STATIC char* write_attrs_on( char* out, ATTR attrs )
+     {
+      for( const auto& entry: attr_on )
+       {
+        if( any( attrs & entry.attrs ) ) out = write_code( out, entry.code );
+       }
+      return out;
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // apply_sgr
+  /**
+   * @brief Applies the parameters of a single SGR sequence to a style, e.g. those collected by an AnsiParser. Unknown parameters are ignored.
+   *
+   * @param style The style to be modified.
+   * @param params The parameters of the sequence, an empty one counting as 0.
+   * @param size The number of parameters.
+   * @param subparams Bit i is set if params[ i ] is a sub-parameter, i.e. it follows a ':' as in "38:2::255:0:0". Sub-parameters only apply to the code they follow and are never read as codes. Default is none.
+   */
+  OSMANIP_INLINE void apply_sgr( Style& style, const uint32_t* params, size_t size, uint32_t subparams )
+   {
+    for( size_t i = 0; i < size; i++ )
+     {
+      const uint32_t p = params[ i ];
+      const uint32_t* sub = params + i + 1;
+      size_t subs = 0;
+      while( i + 1 + subs < size && i + 1 + subs < 32 && ( subparams >> ( i + 1 + subs ) & 1u ) ) subs++;
+
+      if( subs > 0 && p == 4 )
+       {
+        // "4:0" is no underline, "4:2" double, any other style (curly, dotted, ...) is drawn as single
+        style.attrs = style.attrs & ~( ATTR::UNDERLINED | ATTR::D_UNDERLINED );
+        if( sub[ 0 ] == 2 ) style.attrs = style.attrs | ATTR::D_UNDERLINED;
+        else if( sub[ 0 ] != 0 ) style.attrs = style.attrs | ATTR::UNDERLINED;
+       }
+      else if( subs > 0 && ( p == 38 || p == 48 || p == 58 ) )
+       {
+        // Colon form: "38:5:n", "38:2:r:g:b" or "38:2:colorspace:r:g:b". The underline color (58) is not tracked
+        Color ignored;
+        Color& color = ( p == 38 ) ? style.fg : ( p == 48 ) ? style.bg : ignored;
+        if( sub[ 0 ] == 5 && subs >= 2 ) color = Color::indexed( static_cast<uint8_t>( sub[ 1 ] ) );
+        else if( sub[ 0 ] == 2 && subs >= 5 ) color = Color::rgb( static_cast<uint8_t>( sub[ 2 ] ), static_cast<uint8_t>( sub[ 3 ] ), static_cast<uint8_t>( sub[ 4 ] ) );
+        else if( sub[ 0 ] == 2 && subs == 4 ) color = Color::rgb( static_cast<uint8_t>( sub[ 1 ] ), static_cast<uint8_t>( sub[ 2 ] ), static_cast<uint8_t>( sub[ 3 ] ) );
+       }
+      else if( p == 0 ) style = Style{};
+      else if( p == 22 ) style.attrs = style.attrs & ~( ATTR::BOLD | ATTR::FAINT );
+      else if( p == 24 ) style.attrs = style.attrs & ~( ATTR::UNDERLINED | ATTR::D_UNDERLINED );
+      else if( p >= 30 && p <= 37 ) style.fg = Color::basic( static_cast<uint8_t>( p - 30 ) );
+      else if( p >= 90 && p <= 97 ) style.fg = Color::basic( static_cast<uint8_t>( p - 82 ) );
+      else if( p >= 40 && p <= 47 ) style.bg = Color::basic( static_cast<uint8_t>( p - 40 ) );
+      else if( p >= 100 && p <= 107 ) style.bg = Color::basic( static_cast<uint8_t>( p - 92 ) );
+      else if( p == 39 ) style.fg = Color{};
+      else if( p == 49 ) style.bg = Color{};
+      else if( p == 38 || p == 48 || p == 58 )
+       {
+        Color ignored;
+        Color& color = ( p == 38 ) ? style.fg : ( p == 48 ) ? style.bg : ignored;
+        if( i + 2 < size && params[ i + 1 ] == 5 )
+         {
+          color = Color::indexed( static_cast<uint8_t>( params[ i + 2 ] ) );
+          i += 2;
+         }
+        else if( i + 4 < size && params[ i + 1 ] == 2 )
+         {
+          color = Color::rgb( static_cast<uint8_t>( params[ i + 2 ] ), static_cast<uint8_t>( params[ i + 3 ] ), static_cast<uint8_t>( params[ i + 4 ] ) );
+          i += 4;
+         }
+        else break;
+       }
+      else
+       {
+        for( const auto& entry: detail::attr_on )
+         {
+          if( entry.code == p ) style.attrs = style.attrs | entry.attrs;
+         }
+        for( const auto& entry: detail::attr_off )
+         {
+          if( entry.code == p ) style.attrs = style.attrs & ~entry.attrs;
+         }
+       }
+
+      i += subs;
+     }
+   }
+
+  // parse_sgr
+  /**
+   * @brief Applies the SGR sequences found in a string (e.g. a concatenation of feat results) to a style. Other characters and sequences, as well as unknown parameters, are ignored.
+   *
+   * @param sequences The string containing the sequences.
+   * @param base The style to which the sequences are applied. Default is the terminal default.
+   * @return Style The resulting style.
+   */
+  OSMANIP_INLINE Style parse_sgr( std::string_view sequences, Style base )
+   {
+    constexpr size_t max_params = 32;
+    uint32_t params[ max_params ];
+    uint32_t subparams;
+
+    size_t i = sequences.find( "\033[" );
+    while( i != std::string_view::npos )
+     {
+      size_t size = 0;
+      uint32_t current = 0;
+      bool sub = false;
+      subparams = 0;
+
+      for( i += 2; i < sequences.size(); i++ )
+       {
+        const char c = sequences[ i ];
+        if( c >= '0' && c <= '9' ) current = current * 10 + static_cast<uint32_t>( c - '0' );
+        else if( c == ';' || c == ':' )
+         {
+          if( size < max_params )
+           {
+            if( sub ) subparams |= 1u << size;
+            params[ size++ ] = current;
+           }
+          current = 0;
+          sub = ( c == ':' );
+         }
+        else break;
+       }
+
+      if( i < sequences.size() && sequences[ i ] == 'm' )
+       {
+        if( size < max_params )
+         {
+          if( sub ) subparams |= 1u << size;
+          params[ size++ ] = current;
+         }
+        apply_sgr( base, params, size, subparams );
+       }
+
+      i = sequences.find( "\033[", i );
+     }
+
+    return base;
+   }
+
+  // strip_sgr
+  /**
+   * @brief Removes the SGR sequences from a string, keeping the characters and sequences ignored by parse_sgr, e.g. cursor movements or hyperlinks.
+   *
+   * @param sequences The string containing the sequences.
+   * @return std::string The string without SGR sequences.
+   */
+  OSMANIP_INLINE std::string strip_sgr( std::string_view sequences )
+   {
+    std::string rest;
+    size_t begin = 0;
+    size_t i = sequences.find( "\033[" );
+    while( i != std::string_view::npos )
+     {
+      size_t end = i + 2;
+      while( end < sequences.size() && ( ( sequences[ end ] >= '0' && sequences[ end ] <= '9' ) || sequences[ end ] == ';' || sequences[ end ] == ':' ) )
+       {
+        end++;
+       }
+
+      if( end < sequences.size() && sequences[ end ] == 'm' )
+       {
+        rest.append( sequences.data() + begin, i - begin );
+        begin = end + 1;
+       }
+
+      i = sequences.find( "\033[", end );
+     }
+    rest.append( sequences.data() + begin, sequences.size() - begin );
+
+    return rest;
+   }
+
+  // write_sgr
+  /**
+   * @brief Writes the shortest single SGR sequence moving the terminal from one style to another: either the differences only, or a reset followed by the whole target style. Nothing is written if the styles are equal.
+   *
+   * @param out The buffer, with room for at least SGR_MAX_SIZE characters.
+   * @param from The current style.
+   * @param to The target style.
+   * @param full_reset If false only the differences are written, so that attributes set outside the given styles are kept.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* write_sgr( char* out, const Style& from, const Style& to, bool full_reset )
+   {
+    if( from == to )
+     {
+      return out;
+     }
+
+    // Differences only
+    char delta[ SGR_MAX_SIZE ];
+    char* delta_end = delta;
+
+    const ATTR removed = from.attrs & ~to.attrs;
+    ATTR added = to.attrs & ~from.attrs;
+
+    for( const auto& entry: detail::attr_off )
+     {
+      if( any( removed & entry.attrs ) )
+       {
+        delta_end = detail::write_code( delta_end, entry.code );
+        added = added | ( to.attrs & entry.attrs );      // Attributes sharing the code and still wanted
+       }
+     }
+    delta_end = detail::write_attrs_on( delta_end, added );
+    if( from.fg != to.fg ) delta_end = detail::write_color_codes( delta_end, to.fg, false );
+    if( from.bg != to.bg ) delta_end = detail::write_color_codes( delta_end, to.bg, true );
+
+    // Reset and whole style
+    char full[ SGR_MAX_SIZE ];
+    char* full_end = detail::write_code( full, 0 );
+    full_end = detail::write_attrs_on( full_end, to.attrs );
+    if( to.fg.type != COLORTYPE::DEFAULT ) full_end = detail::write_color_codes( full_end, to.fg, false );
+    if( to.bg.type != COLORTYPE::DEFAULT ) full_end = detail::write_color_codes( full_end, to.bg, true );
+
+    const bool use_delta = ! full_reset || ( delta_end - delta ) <= ( full_end - full );
+    const char* first = use_delta ? delta : full;
+    const char* last = ( use_delta ? delta_end : full_end ) - 1;      // Drop the trailing ";"
+
+    *out++ = '\033';
+    *out++ = '[';
+    while( first != last ) *out++ = *first++;
+    *out++ = 'm';
+
+    return out;
+   }
+
+  // sgr
+  /**
+   * @brief Convenience form of write_sgr. Returns an empty string if colors are disabled.
+   *
+   * @param from The current style.
+   * @param to The target style.
+   * @return esc_string The SGR sequence.
+   */
+  OSMANIP_INLINE esc_string sgr( const Style& from, const Style& to )
+   {
+    if( ! colors_enabled() )
+     {
+      return {};
+     }
+
+    char buffer[ SGR_MAX_SIZE ];
+    return esc_string( buffer, write_sgr( buffer, from, to ) );
+   }
+
+  //====================================================
+  //     SgrState methods
+  //====================================================
+
+  // apply
+  /**
+   * @brief Writes the sequence moving the stream to a new style into a buffer and records it as the current one.
+   *
+   * @param out The buffer, with room for at least SGR_MAX_SIZE characters.
+   * @param style The new style.
+   * @return char* One past the last written character.
+   */
+  OSMANIP_INLINE char* SgrState::apply( char* out, const Style& style )
+   {
+    const Style target = base_ | style;
+    out = write_sgr( out, current_, target, full_reset_ );
+    current_ = target;
+    return out;
+   }
+
+  /**
+   * @brief Returns the sequence moving the stream to a new style and records it as the current one. If colors are disabled nothing is emitted and the state is left unchanged.
+   *
+   * @param style The new style.
+   * @return esc_string The SGR sequence.
+   */
+  OSMANIP_INLINE esc_string SgrState::apply( const Style& style )
+   {
+    if( ! colors_enabled() )
+     {
+      return {};
+     }
+
+    char buffer[ SGR_MAX_SIZE ];
+    return esc_string( buffer, apply( buffer, style ) );
+   }
+
+  /**
+   * @brief Writes the sequence moving the stream to a new style into the stream and records it as the current one. If colors are disabled nothing is emitted and the state is left unchanged.
+   *
+   * @param os The stream.
+   * @param style The new style.
+   * @return std::ostream& The stream.
+   */
+  OSMANIP_INLINE std::ostream& SgrState::apply( std::ostream& os, const Style& style )
+   {
+    if( colors_enabled() )
+     {
+      char buffer[ SGR_MAX_SIZE ];
+      os.write( buffer, apply( buffer, style ) - buffer );
+     }
+    return os;
+   }
+ }
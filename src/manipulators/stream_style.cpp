@@ -0,0 +1,218 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file stream_style.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+
+//STD headers
+#include <ios>
+#include <ostream>
+#include <utility>
+
+namespace osm
+ {
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // stream_style_index
+    /**
+     * @brief Returns the index of the std::ios_base storage slot of the stream decoration state: the pword holds the state and the iword tells whether the callback which owns it has been registered.
+     *
+     */
+    OSMANIP_STATIC int stream_style_index()
+     {
+      static const int index = std::ios_base::xalloc();
+      return index;
+     }
+
+    // stream_style_callback
+    /**
+     * @brief Deletes the state when the stream is destroyed and makes a deep copy of it when the stream format is copied with copyfmt.
+     *
+     */
+    OSMANIP_STATIC void stream_style_callback( std::ios_base::event event, std::ios_base& ios, int index )
+     {
+      void*& state = ios.pword( index );
+      if( state == nullptr )
+       {
+        return;
+       }
+
+      if( event == std::ios_base::erase_event )
+       {
+        delete static_cast<StreamStyle*>( state );
+        state = nullptr;
+       }
+      else if( event == std::ios_base::copyfmt_event )
+       {
+        StreamStyle* copy = new StreamStyle( *static_cast<StreamStyle*>( state ) );
+        copy -> decorators.clear();
+        copy -> alive.reset();
+        state = copy;
+       }
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // stream_style
+  /**
+   * @brief Returns the decoration state of a stream, creating it at the first call.
+   *
+   * @param ios The stream.
+   * @return StreamStyle& The decoration state of the stream.
+   */
+  OSMANIP_INLINE StreamStyle& stream_style( std::ios_base& ios )
+   {
+    const int index = detail::stream_style_index();
+    void*& state = ios.pword( index );
+
+    if( state == nullptr )
+     {
+      state = new StreamStyle();
+      if( ios.iword( index ) == 0 )
+       {
+        ios.register_callback( detail::stream_style_callback, index );
+        ios.iword( index ) = 1;
+       }
+     }
+
+    return *static_cast<StreamStyle*>( state );
+   }
+
+  // find_stream_style
+  /**
+   * @brief Returns the decoration state of a stream, without creating it.
+   *
+   * @param ios The stream.
+   * @return StreamStyle* The decoration state of the stream, or nullptr if it has never been decorated.
+   */
+  OSMANIP_INLINE StreamStyle* find_stream_style( std::ios_base& ios )
+   {
+    return static_cast<StreamStyle*>( ios.pword( detail::stream_style_index() ) );
+   }
+
+  // current_style
+  /**
+   * @brief Returns the style a stream has been moved to by the manipulators.
+   *
+   * @param ios The stream.
+   * @return Style The current style of the stream, the default one if it has never been decorated.
+   */
+  OSMANIP_INLINE Style current_style( std::ios_base& ios )
+   {
+    const StreamStyle* state = find_stream_style( ios );
+    return state ? state -> sgr.current() : Style{};
+   }
+
+  //====================================================
+  //     StyleScope methods
+  //====================================================
+
+  // Constructor
+  /**
+   * @brief Records the current style of the stream in its stack and moves the stream to the current style combined with the new one.
+   *
+   * @param os The stream.
+   * @param style The style added to the current one.
+   */
+  OSMANIP_INLINE StyleScope::StyleScope( std::ostream& os, const Style& style ):
+   os_( &os ),
+   depth_( 0 )
+   {
+    StreamStyle& state = stream_style( os );
+    const Style enclosing = state.sgr.current();
+
+    depth_ = state.stack.size();
+    state.stack.push_back( enclosing );
+    state.sgr.apply( os, enclosing | style );
+   }
+
+  // Move constructor
+  /**
+   * @brief Takes over the region of another scope, which won't restore anything.
+   *
+   * @param other The moved scope.
+   */
+  OSMANIP_INLINE StyleScope::StyleScope( StyleScope&& other ) noexcept:
+   os_( std::exchange( other.os_, nullptr ) ),
+   depth_( other.depth_ )
+   {}
+
+  // Destructor
+  /**
+   * @brief Closes the region, if still open.
+   *
+   */
+  OSMANIP_INLINE StyleScope::~StyleScope()
+   {
+    try
+     {
+      pop();
+     }
+    catch( ... ) {}
+   }
+
+  // pop
+  /**
+   * @brief Closes the region before the end of the scope, moving the stream back to the style it had when the region was opened. Further calls do nothing.
+   *
+   */
+  OSMANIP_INLINE void StyleScope::pop()
+   {
+    if( os_ == nullptr )
+     {
+      return;
+     }
+
+    std::ostream& os = *std::exchange( os_, nullptr );
+    StreamStyle* state = find_stream_style( os );
+    if( state == nullptr || state -> stack.size() <= depth_ )
+     {
+      return;
+     }
+
+    const Style enclosing = state -> stack[ depth_ ];
+    state -> stack.resize( depth_ );
+    state -> sgr.apply( os, enclosing );
+   }
+
+  //====================================================
+  //     Operators
+  //====================================================
+
+  // operator <<
+  /**
+   * @brief Writes the sequence moving the stream to the style of the manipulator. Nothing is emitted if colors are disabled or if the stream already has that style.
+   *
+   * @param os The stream.
+   * @param decor The manipulator.
+   * @return std::ostream& The stream.
+   */
+  OSMANIP_INLINE std::ostream& operator << ( std::ostream& os, const Decor& decor )
+   {
+    if( decor.style.isDefault() && find_stream_style( os ) == nullptr )
+     {
+      return os;
+     }
+
+    return stream_style( os ).sgr.apply( os, decor.style );
+   }
+ }
@@ -0,0 +1,237 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file style_registry.cpp
+ * @author Gianluca Bianco (biancogianluca9@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/utility/small_string.hpp>
+#include <osmanip/utility/terminal.hpp>
+
+//STD headers
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+ {
+  //====================================================
+  //     Structs
+  //====================================================
+
+  namespace detail
+   {
+    // RegistryEntry
+    /**
+     * @brief Interned style, together with its SGR sequence from the default style.
+     *
+     */
+    struct RegistryEntry
+     {
+      Style style;
+      esc_string sequence;
+     };
+
+    // RegistryBlock
+    /**
+     * @brief Fixed-size block of entries. Blocks are never moved nor freed, so that entries can be read without locking while new ones are added.
+     *
+     */
+    struct RegistryBlock
+     {
+      static constexpr size_t size = 256;
+      RegistryEntry entries[ size ];
+     };
+   }      // namespace detail
+
+  //====================================================
+  //     Variables
+  //====================================================
+
+  namespace detail
+   {
+    // Blocks and count are constant-initialized, so that the registry has no static initialization cost.
+    OSMANIP_STATIC std::atomic<RegistryBlock*> registry_blocks[ STYLE_REGISTRY_SIZE / RegistryBlock::size ];
+    OSMANIP_STATIC std::atomic<size_t> registry_size { 1 };
+    OSMANIP_STATIC std::mutex registry_mutex;
+   }      // namespace detail
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+   {
+    // color_key
+    /**
+     * @brief Packs a color into 26 bits.
+     *
+     */
+    OSMANIP_STATIC constexpr uint64_t color_key( const Color& color )
+     {
+      return static_cast<uint64_t>( color.type ) << 24 | static_cast<uint64_t>( color.r ) << 16 | static_cast<uint64_t>( color.g ) << 8 | color.b;
+     }
+
+    // style_key
+    /**
+     * @brief Packs a style into a single integer, used as the key of the interning index.
+     *
+     */
+    OSMANIP_STATIC constexpr uint64_t style_key( const Style& style )
+     {
+      return color_key( style.fg ) << 35 | color_key( style.bg ) << 9 | static_cast<uint64_t>( style.attrs );
+     }
+
+    // entry
+    /**
+     * @brief Returns the entry of an interned id.
+     *
+     */
+    OSMANIP_STATIC const RegistryEntry& entry( uint16_t id )
+     {
+      return registry_blocks[ id / RegistryBlock::size ].load( std::memory_order_acquire ) -> entries[ id % RegistryBlock::size ];
+     }
+   }      // namespace detail
+
+  //====================================================
+  //     StyleHandle methods
+  //====================================================
+
+  // style
+  /**
+   * @brief Returns the interned style.
+   *
+   * @return const Style& The style of the handle.
+   */
+  OSMANIP_INLINE const Style& StyleHandle::style() const
+   {
+    static constexpr Style default_style {};
+    return id_ == 0 ? default_style : detail::entry( id_ ).style;
+   }
+
+  // sequence
+  /**
+   * @brief Returns the cached SGR sequence moving the terminal from the default style to the interned one.
+   *
+   * @return std::string_view The SGR sequence, empty for the default style.
+   */
+  OSMANIP_INLINE std::string_view StyleHandle::sequence() const
+   {
+    if( id_ == 0 )
+     {
+      return {};
+     }
+
+    const esc_string& sequence = detail::entry( id_ ).sequence;
+    return std::string_view( sequence.data(), sequence.size() );
+   }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // intern
+  /**
+   * @brief Returns the handle of a style, adding it to the registry the first time it is met. Throws if the registry is full.
+   *
+   * @param style The style.
+   * @return StyleHandle The handle of the style.
+   */
+  OSMANIP_INLINE StyleHandle intern( const Style& style )
+   {
+    if( style.isDefault() )
+     {
+      return StyleHandle();
+     }
+
+    std::lock_guard<std::mutex> lock( detail::registry_mutex );
+
+    static std::unordered_map<uint64_t, uint16_t> index;
+    const auto found = index.find( detail::style_key( style ) );
+    if( found != index.end() )
+     {
+      return StyleHandle( found -> second );
+     }
+
+    const size_t id = detail::registry_size.load( std::memory_order_relaxed );
+    if( id >= STYLE_REGISTRY_SIZE )
+     {
+      throw std::runtime_error( "The style registry is full!" );
+     }
+
+    std::atomic<detail::RegistryBlock*>& block = detail::registry_blocks[ id / detail::RegistryBlock::size ];
+    if( block.load( std::memory_order_relaxed ) == nullptr )
+     {
+      block.store( new detail::RegistryBlock(), std::memory_order_release );
+     }
+
+    detail::RegistryEntry& new_entry = block.load( std::memory_order_relaxed ) -> entries[ id % detail::RegistryBlock::size ];
+    char buffer[ SGR_MAX_SIZE ];
+    new_entry.style = style;
+    new_entry.sequence = esc_string( buffer, write_sgr( buffer, Style{}, style ) );
+
+    index.emplace( detail::style_key( style ), static_cast<uint16_t>( id ) );
+    detail::registry_size.store( id + 1, std::memory_order_release );
+
+    return StyleHandle( static_cast<uint16_t>( id ) );
+   }
+
+  /**
+   * @brief Returns the handle of the style set by a string of SGR sequences, e.g. feat( col, "red" ) + feat( sty, "bold" ).
+   *
+   * @param sequences The SGR sequences.
+   * @return StyleHandle The handle of the style.
+   */
+  OSMANIP_INLINE StyleHandle intern( std::string_view sequences )
+   {
+    return intern( parse_sgr( sequences ) );
+   }
+
+  // interned_styles
+  /**
+   * @brief Returns the number of interned styles, including the default one.
+   *
+   * @return size_t The number of interned styles.
+   */
+  OSMANIP_INLINE size_t interned_styles()
+   {
+    return detail::registry_size.load( std::memory_order_acquire );
+   }
+
+  //====================================================
+  //     Operators
+  //====================================================
+
+  // operator <<
+  /**
+   * @brief Writes the cached sequence of the style into the stream, if colors are enabled.
+   *
+   * @param os The stream.
+   * @param handle The handle of the style.
+   * @return std::ostream& The stream.
+   */
+  OSMANIP_INLINE std::ostream& operator << ( std::ostream& os, StyleHandle handle )
+   {
+    if( colors_enabled() )
+     {
+      const std::string_view sequence = handle.sequence();
+      os.write( sequence.data(), static_cast<std::streamsize>( sequence.size() ) );
+     }
+    return os;
+   }
+ }
@@ -0,0 +1,316 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_parser.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/utility/ansi_scan.hpp>
+
+// STD headers
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    // Character classes of the VT500 parser
+    OSMANIP_STATIC constexpr bool is_c0( unsigned char c ) { return c < 0x20; }
+    OSMANIP_STATIC constexpr bool is_intermediate( unsigned char c ) { return c >= 0x20 && c <= 0x2F; }
+    OSMANIP_STATIC constexpr bool is_csi_final( unsigned char c ) { return c >= 0x40 && c <= 0x7E; }
+    OSMANIP_STATIC constexpr bool is_esc_final( unsigned char c ) { return c >= 0x30 && c <= 0x7E; }
+
+    // Parameters are saturated rather than overflowing
+    OSMANIP_STATIC constexpr uint32_t MAX_PARAM_VALUE = 99999;
+  }      // namespace detail
+
+  //====================================================
+  //     Methods
+  //====================================================
+
+  // feed
+  /**
+   * @brief Parses a chunk of the stream, calling the handler for each text run and complete sequence. A sequence which is not complete at the end of the chunk is kept and completed by the next call.
+   *
+   * @param chunk the next part of the stream.
+   * @param handler the receiver of the events.
+   *
+   */
+  OSMANIP_INLINE void AnsiParser::feed( std::string_view chunk, AnsiHandler & handler )
+  {
+    const char * p = chunk.data();
+    const char * const end = p + chunk.size();
+
+    while( p < end )
+    {
+      // Printable characters are passed on in a single run
+      if( state_ == STATE::GROUND )
+      {
+        const char * run = p;
+        const size_t control = find_control( std::string_view( p, static_cast<size_t>( end - p ) ) );
+        p = control == std::string_view::npos ? end : p + control;
+
+        if( p != run )
+        {
+          handler.text( std::string_view( run, static_cast<size_t>( p - run ) ) );
+        }
+        if( p == end )
+        {
+          break;
+        }
+      }
+
+      const unsigned char c = static_cast<unsigned char>( *p++ );
+
+      // Transitions valid in any state: CAN and SUB cancel the sequence, ESC starts a new one
+      if( c == 0x18 || c == 0x1A )
+      {
+        state_ = STATE::GROUND;
+        continue;
+      }
+      if( c == 0x1B )
+      {
+        if( state_ == STATE::OSC_STRING )
+        {
+          handler.osc( std::string_view( osc_, osc_size_ ) );
+        }
+        intermediate_ = '\0';
+        state_ = STATE::ESCAPE;
+        continue;
+      }
+
+      switch( state_ )
+      {
+        case STATE::GROUND:
+        {
+          handler.control( static_cast<char>( c ) );
+          break;
+        }
+        case STATE::ESCAPE:
+        case STATE::ESCAPE_INTERMEDIATE:
+        {
+          if( detail::is_c0( c ) )
+          {
+            handler.control( static_cast<char>( c ) );
+          }
+          else if( detail::is_intermediate( c ) )
+          {
+            intermediate_ = static_cast<char>( c );
+            state_ = STATE::ESCAPE_INTERMEDIATE;
+          }
+          else if( state_ == STATE::ESCAPE && c == '[' )
+          {
+            clear_csi();
+            state_ = STATE::CSI_PARAM;
+          }
+          else if( state_ == STATE::ESCAPE && c == ']' )
+          {
+            osc_size_ = 0;
+            state_ = STATE::OSC_STRING;
+          }
+          else if( state_ == STATE::ESCAPE && ( c == 'P' || c == 'X' || c == '^' || c == '_' ) )
+          {
+            state_ = STATE::IGNORE_STRING;
+          }
+          else if( state_ == STATE::ESCAPE && c == '\\' )
+          {
+            // String terminator, closing an OSC or an ignored string
+            state_ = STATE::GROUND;
+          }
+          else if( detail::is_esc_final( c ) )
+          {
+            handler.esc( static_cast<char>( c ), intermediate_ );
+            state_ = STATE::GROUND;
+          }
+          break;
+        }
+        case STATE::CSI_PARAM:
+        {
+          if( c >= '0' && c <= '9' )
+          {
+            param_ = param_ < detail::MAX_PARAM_VALUE ? param_ * 10 + ( c - '0' ) : detail::MAX_PARAM_VALUE;
+            has_param_ = true;
+          }
+          else if( c == ';' || c == ':' )
+          {
+            if( csi_.size < AnsiCsi::MAX_PARAMS )
+            {
+              if( sub_param_ ) csi_.subparams |= static_cast<uint16_t>( 1u << csi_.size );
+              csi_.params[ csi_.size++ ] = param_;
+            }
+            param_ = 0;
+            has_param_ = true;
+            sub_param_ = ( c == ':' );
+          }
+          else if( c >= 0x3C && c <= 0x3F )
+          {
+            // A private marker is only valid before the parameters
+            if( csi_.size == 0 && !has_param_ && csi_.prefix == '\0' )
+            {
+              csi_.prefix = static_cast<char>( c );
+            }
+            else
+            {
+              state_ = STATE::CSI_IGNORE;
+            }
+          }
+          else if( detail::is_intermediate( c ) )
+          {
+            csi_.intermediate = static_cast<char>( c );
+            state_ = STATE::CSI_INTERMEDIATE;
+          }
+          else if( detail::is_csi_final( c ) )
+          {
+            dispatch_csi( static_cast<char>( c ), handler );
+            state_ = STATE::GROUND;
+          }
+          else if( detail::is_c0( c ) )
+          {
+            handler.control( static_cast<char>( c ) );
+          }
+          break;
+        }
+        case STATE::CSI_INTERMEDIATE:
+        {
+          if( detail::is_intermediate( c ) )
+          {
+            csi_.intermediate = static_cast<char>( c );
+          }
+          else if( detail::is_csi_final( c ) )
+          {
+            dispatch_csi( static_cast<char>( c ), handler );
+            state_ = STATE::GROUND;
+          }
+          else if( detail::is_c0( c ) )
+          {
+            handler.control( static_cast<char>( c ) );
+          }
+          else if( c >= 0x30 && c <= 0x3F )
+          {
+            state_ = STATE::CSI_IGNORE;
+          }
+          break;
+        }
+        case STATE::CSI_IGNORE:
+        {
+          if( detail::is_csi_final( c ) )
+          {
+            state_ = STATE::GROUND;
+          }
+          else if( detail::is_c0( c ) )
+          {
+            handler.control( static_cast<char>( c ) );
+          }
+          break;
+        }
+        case STATE::OSC_STRING:
+        {
+          if( c == 0x07 )
+          {
+            handler.osc( std::string_view( osc_, osc_size_ ) );
+            state_ = STATE::GROUND;
+          }
+          else if( !detail::is_c0( c ) && osc_size_ < MAX_OSC_SIZE )
+          {
+            osc_[ osc_size_++ ] = static_cast<char>( c );
+          }
+          break;
+        }
+        case STATE::IGNORE_STRING:
+        {
+          if( c == 0x07 )
+          {
+            state_ = STATE::GROUND;
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  // reset
+  /**
+   * @brief Drops any pending sequence and resets the tracked style to the terminal default.
+   *
+   */
+  OSMANIP_INLINE void AnsiParser::reset()
+  {
+    state_ = STATE::GROUND;
+    clear_csi();
+    intermediate_ = '\0';
+    osc_size_ = 0;
+    style_ = Style{};
+  }
+
+  //====================================================
+  //     Private methods
+  //====================================================
+
+  // dispatch_csi
+  /**
+   * @brief Completes the current CSI sequence and passes it to the handler. SGR sequences are applied to the tracked style first.
+   *
+   * @param final the final byte of the sequence.
+   * @param handler the receiver of the event.
+   *
+   */
+  OSMANIP_INLINE void AnsiParser::dispatch_csi( char final, AnsiHandler & handler )
+  {
+    if( has_param_ && csi_.size < AnsiCsi::MAX_PARAMS )
+    {
+      if( sub_param_ ) csi_.subparams |= static_cast<uint16_t>( 1u << csi_.size );
+      csi_.params[ csi_.size++ ] = param_;
+    }
+    csi_.final = final;
+
+    if( final == 'm' && csi_.prefix == '\0' && csi_.intermediate == '\0' )
+    {
+      // "ESC[m" is a reset, like "ESC[0m"
+      if( csi_.size == 0 )
+      {
+        csi_.params[ csi_.size++ ] = 0;
+      }
+
+      apply_sgr( style_, csi_.params, csi_.size, csi_.subparams );
+      handler.sgr( style_ );
+    }
+    else
+    {
+      handler.csi( csi_ );
+    }
+  }
+
+  // clear_csi
+  /**
+   * @brief Prepares the parser to collect a new CSI sequence.
+   *
+   */
+  OSMANIP_INLINE void AnsiParser::clear_csi()
+  {
+    csi_.size = 0;
+    csi_.subparams = 0;
+    csi_.prefix = '\0';
+    csi_.intermediate = '\0';
+    csi_.final = '\0';
+    param_ = 0;
+    has_param_ = false;
+    sub_param_ = false;
+  }
+
+}      // namespace osm
@@ -0,0 +1,324 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file ansi_scan.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_scan.hpp>
+
+// STD headers
+#include <string>
+#include <string_view>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Instruction set used to scan the text, chosen at compile time: AVX2 must be enabled explicitly (e.g. -mavx2 or
+// -march=native), while SSE2 is part of every x86-64 target.
+#if defined( __AVX2__ )
+#define OSMANIP_SCAN_AVX2
+#define OSMANIP_SCAN_SSE2
+#include <immintrin.h>
+#elif defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 )
+#define OSMANIP_SCAN_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined( _MSC_VER ) && !defined( __clang__ )
+#include <intrin.h>
+#endif
+
+namespace osm
+{
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    // first_set
+    /**
+     * @brief Returns the index of the lowest set bit of a non-zero mask.
+     *
+     */
+    OSMANIP_STATIC size_t first_set( uint32_t mask )
+    {
+#if defined( _MSC_VER ) && !defined( __clang__ )
+      unsigned long index;
+      _BitScanForward( &index, mask );
+      return static_cast<size_t>( index );
+#else
+      return static_cast<size_t>( __builtin_ctz( mask ) );
+#endif
+    }
+
+    // is_string_start
+    /**
+     * @brief Tells whether the character following ESC starts a string, which lasts until BEL or ST: OSC, DCS, SOS, PM or APC.
+     *
+     */
+    OSMANIP_STATIC constexpr bool is_string_start( unsigned char c )
+    {
+      return c == ']' || c == 'P' || c == 'X' || c == '^' || c == '_';
+    }
+  }      // namespace detail
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // find_escape
+  /**
+   * @brief Finds the first ESC character of a string, starting from the given position.
+   *
+   * @param str the string to be searched.
+   * @param pos the starting position.
+   *
+   * @return the index of the ESC character if found, otherwise std::string::npos.
+   *
+   */
+  OSMANIP_INLINE size_t find_escape( std::string_view str, size_t pos )
+  {
+    if( pos >= str.size() )
+    {
+      return std::string::npos;
+    }
+
+    const char * const data = str.data();
+    const char * p = data + pos;
+    const char * const end = data + str.size();
+
+#ifdef OSMANIP_SCAN_AVX2
+    const __m256i esc_32 = _mm256_set1_epi8( 0x1B );
+    for( ; end - p >= 32; p += 32 )
+    {
+      const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( p ) );
+      if( const uint32_t mask = static_cast<uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( block, esc_32 ) ) ) )
+      {
+        return static_cast<size_t>( p - data ) + detail::first_set( mask );
+      }
+    }
+#endif
+
+#ifdef OSMANIP_SCAN_SSE2
+    const __m128i esc_16 = _mm_set1_epi8( 0x1B );
+    for( ; end - p >= 16; p += 16 )
+    {
+      const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i *>( p ) );
+      if( const uint32_t mask = static_cast<uint32_t>( _mm_movemask_epi8( _mm_cmpeq_epi8( block, esc_16 ) ) ) )
+      {
+        return static_cast<size_t>( p - data ) + detail::first_set( mask );
+      }
+    }
+    for( ; p < end; ++p )
+    {
+      if( *p == '\033' )
+      {
+        return static_cast<size_t>( p - data );
+      }
+    }
+    return std::string::npos;
+#else
+    const void * hit = memchr( p, '\033', static_cast<size_t>( end - p ) );
+    return hit ? static_cast<size_t>( static_cast<const char *>( hit ) - data ) : std::string::npos;
+#endif
+  }
+
+  // find_control
+  /**
+   * @brief Finds the first C0 control character (0x00 to 0x1F, ESC included) of a string, starting from the given position. Printable characters, UTF-8 sequences included, can be skipped up to this position in a single run.
+   *
+   * @param str the string to be searched.
+   * @param pos the starting position.
+   *
+   * @return the index of the control character if found, otherwise std::string::npos.
+   *
+   */
+  OSMANIP_INLINE size_t find_control( std::string_view str, size_t pos )
+  {
+    if( pos >= str.size() )
+    {
+      return std::string::npos;
+    }
+
+    const char * const data = str.data();
+    const char * p = data + pos;
+    const char * const end = data + str.size();
+
+    // A byte is a control character if it is unchanged by an unsigned minimum with 0x1F
+#ifdef OSMANIP_SCAN_AVX2
+    const __m256i c0_32 = _mm256_set1_epi8( 0x1F );
+    for( ; end - p >= 32; p += 32 )
+    {
+      const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i *>( p ) );
+      const __m256i is_c0 = _mm256_cmpeq_epi8( _mm256_min_epu8( block, c0_32 ), block );
+      if( const uint32_t mask = static_cast<uint32_t>( _mm256_movemask_epi8( is_c0 ) ) )
+      {
+        return static_cast<size_t>( p - data ) + detail::first_set( mask );
+      }
+    }
+#endif
+
+#ifdef OSMANIP_SCAN_SSE2
+    const __m128i c0_16 = _mm_set1_epi8( 0x1F );
+    for( ; end - p >= 16; p += 16 )
+    {
+      const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i *>( p ) );
+      const __m128i is_c0 = _mm_cmpeq_epi8( _mm_min_epu8( block, c0_16 ), block );
+      if( const uint32_t mask = static_cast<uint32_t>( _mm_movemask_epi8( is_c0 ) ) )
+      {
+        return static_cast<size_t>( p - data ) + detail::first_set( mask );
+      }
+    }
+#else
+    // Words with a byte lower than 0x20 are detected without false negatives, the byte is then found one at a time
+    constexpr uint64_t ONES = 0x0101010101010101ULL, HIGHS = 0x8080808080808080ULL;
+    for( ; end - p >= 8; p += 8 )
+    {
+      uint64_t word;
+      memcpy( &word, p, sizeof( word ) );
+      if( ( word - ONES * 0x20 ) & ~word & HIGHS )
+      {
+        break;
+      }
+    }
+#endif
+
+    for( ; p < end; ++p )
+    {
+      if( static_cast<unsigned char>( *p ) < 0x20 )
+      {
+        return static_cast<size_t>( p - data );
+      }
+    }
+    return std::string::npos;
+  }
+
+  // escape_size
+  /**
+   * @brief Returns the size of the escape sequence starting at the given position: a CSI sequence, a string closed by BEL or ST (e.g. OSC), or an escape with optional intermediates. A sequence which is not terminated ends before the first character which cannot belong to it, or at the end of the string.
+   *
+   * @param str the string containing the sequence.
+   * @param pos the index of the ESC character.
+   *
+   * @return the number of characters of the sequence, ESC included.
+   *
+   */
+  OSMANIP_INLINE size_t escape_size( std::string_view str, size_t pos )
+  {
+    const size_t size = str.size();
+    if( pos + 1 >= size )
+    {
+      return size > pos ? 1 : 0;
+    }
+
+    const unsigned char introducer = static_cast<unsigned char>( str[ pos + 1 ] );
+    size_t i = pos + 2;
+
+    // CSI: parameters and intermediates, then the final character
+    if( introducer == '[' )
+    {
+      while( i < size && static_cast<unsigned char>( str[ i ] ) >= 0x20 && static_cast<unsigned char>( str[ i ] ) <= 0x3F )
+      {
+        ++i;
+      }
+      if( i < size && static_cast<unsigned char>( str[ i ] ) >= 0x40 && static_cast<unsigned char>( str[ i ] ) <= 0x7E )
+      {
+        ++i;
+      }
+      return i - pos;
+    }
+
+    // Strings: closed by BEL or ST, while any other ESC starts a new sequence
+    if( detail::is_string_start( introducer ) )
+    {
+      for( i = find_control( str, i ); i != std::string::npos; i = find_control( str, i + 1 ) )
+      {
+        if( str[ i ] == '\a' )
+        {
+          return i + 1 - pos;
+        }
+        if( str[ i ] == '\033' )
+        {
+          return ( i + 1 < size && str[ i + 1 ] == '\\' ? i + 2 : i ) - pos;
+        }
+      }
+      return size - pos;
+    }
+
+    // Other escapes: intermediates, then the final character
+    i = pos + 1;
+    while( i < size && static_cast<unsigned char>( str[ i ] ) >= 0x20 && static_cast<unsigned char>( str[ i ] ) <= 0x2F )
+    {
+      ++i;
+    }
+    if( i < size && static_cast<unsigned char>( str[ i ] ) >= 0x30 && static_cast<unsigned char>( str[ i ] ) <= 0x7E )
+    {
+      ++i;
+    }
+    return i - pos;
+  }
+
+  // strip_ansi
+  /**
+   * @brief Removes the escape sequences of a string, keeping its text and control characters. The text between two sequences is copied in a single block.
+   *
+   * @param str the string to be stripped.
+   *
+   * @return the string without escape sequences.
+   *
+   */
+  OSMANIP_INLINE std::string strip_ansi( std::string_view str )
+  {
+    std::string res;
+    strip_ansi( str, res );
+    return res;
+  }
+
+  /**
+   * @brief Appends a string without its escape sequences to another one, so that a buffer can be reused.
+   *
+   * @param str the string to be stripped.
+   * @param out the string the result is appended to.
+   *
+   */
+  OSMANIP_INLINE void strip_ansi( std::string_view str, std::string & out )
+  {
+    out.reserve( out.size() + str.size() );
+
+    size_t pos = 0;
+    for( size_t esc = find_escape( str ); esc != std::string::npos; esc = find_escape( str, pos ) )
+    {
+      out.append( str.data() + pos, esc - pos );
+      pos = esc + escape_size( str, esc );
+    }
+    out.append( str.data() + pos, str.size() - pos );
+  }
+
+  // scan_method
+  /**
+   * @brief Returns the name of the instruction set used by find_escape and find_control: "AVX2", "SSE2" or "scalar".
+   *
+   */
+  OSMANIP_INLINE const char * scan_method()
+  {
+#if defined( OSMANIP_SCAN_AVX2 )
+    return "AVX2";
+#elif defined( OSMANIP_SCAN_SSE2 )
+    return "SSE2";
+#else
+    return "scalar";
+#endif
+  }
+
+}      // namespace osm
@@ -0,0 +1,284 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file html.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/html.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+
+// STD headers
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <stddef.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    // append_color
+    /**
+     * @brief Appends a CSS property setting a color as "#rrggbb".
+     *
+     */
+    OSMANIP_STATIC void append_color( std::string & out, const char * property, const Color & color )
+    {
+      static constexpr char digits[] = "0123456789abcdef";
+
+      const Color rgb = to_rgb( color );
+      const char value[] = { '#', digits[ rgb.r >> 4 ], digits[ rgb.r & 15 ], digits[ rgb.g >> 4 ], digits[ rgb.g & 15 ], digits[ rgb.b >> 4 ], digits[ rgb.b & 15 ] };
+
+      out.append( property ).append( value, sizeof( value ) ).push_back( ';' );
+    }
+  }      // namespace detail
+
+  //====================================================
+  //     Constructors
+  //====================================================
+
+  // Constructor
+  /**
+   * @brief Construct a new HtmlConverter object.
+   *
+   * @param out the stream the HTML is written to.
+   *
+   */
+  OSMANIP_INLINE HtmlConverter::HtmlConverter( std::ostream & out ):
+   out_( out ),
+   span_open_( false )
+  {
+    buffer_.reserve( CHUNK_SIZE + 256 );
+  }
+
+  //====================================================
+  //     Methods
+  //====================================================
+
+  // feed
+  /**
+   * @brief Converts a chunk of the stream. A sequence split between two chunks is completed by the next call.
+   *
+   * @param chunk the next part of the stream.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::feed( std::string_view chunk )
+  {
+    parser_.feed( chunk, *this );
+  }
+
+  // end
+  /**
+   * @brief Closes the open span, writes the buffered output and resets the converter, which can then convert a new stream.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::end()
+  {
+    close_span();
+    flush_buffer();
+    out_.flush();
+
+    parser_.reset();
+    style_ = Style();
+  }
+
+  // convert
+  /**
+   * @brief Converts a whole stream, e.g. a captured log file, reading it in chunks of CHUNK_SIZE characters.
+   *
+   * @param in the stream to be converted.
+   * @param out the stream the HTML is written to.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::convert( std::istream & in, std::ostream & out )
+  {
+    HtmlConverter converter( out );
+    std::string chunk( CHUNK_SIZE, '\0' );
+    while( in.read( chunk.data(), static_cast<std::streamsize>( chunk.size() ) ) || in.gcount() > 0 )
+    {
+      converter.feed( std::string_view( chunk.data(), static_cast<size_t>( in.gcount() ) ) );
+    }
+    converter.end();
+  }
+
+  //====================================================
+  //     Events
+  //====================================================
+
+  // text
+  /**
+   * @brief Writes a run of text, escaping the characters with a meaning in HTML. The span is opened or changed only if the style of the text differs from the one of the previous run.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::text( std::string_view run )
+  {
+    if( span_open_ && span_style_ != style_ )
+    {
+      close_span();
+    }
+    if( ! span_open_ && ! style_.isDefault() )
+    {
+      open_span();
+    }
+
+    size_t begin = 0;
+    for( size_t i = 0; i < run.size(); i++ )
+    {
+      const char * entity;
+      switch( run[ i ] )
+      {
+        case '&': entity = "&amp;"; break;
+        case '<': entity = "&lt;"; break;
+        case '>': entity = "&gt;"; break;
+        default: continue;
+      }
+      buffer_.append( run.data() + begin, i - begin ).append( entity );
+      begin = i + 1;
+    }
+    buffer_.append( run.data() + begin, run.size() - begin );
+
+    if( buffer_.size() >= CHUNK_SIZE )
+    {
+      flush_buffer();
+    }
+  }
+
+  // control
+  /**
+   * @brief Writes new lines and tabs, other control characters have no HTML equivalent and are dropped.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::control( char code )
+  {
+    if( code == '\n' || code == '\t' )
+    {
+      text( std::string_view( &code, 1 ) );
+    }
+  }
+
+  // sgr
+  /**
+   * @brief Stores the style of the following text. The markup is written with the text, so that styles changed several times between two runs cost nothing.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::sgr( const Style & style )
+  {
+    style_ = style;
+  }
+
+  //====================================================
+  //     Private methods
+  //====================================================
+
+  // open_span
+  /**
+   * @brief Opens a span with the current style. Inverse text swaps the colors, taking the default ones as light gray on black. Blinking has no CSS equivalent and is ignored.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::open_span()
+  {
+    Color fg = style_.fg, bg = style_.bg;
+    if( any( style_.attrs & ATTR::INVERSE ) )
+    {
+      std::swap( fg, bg );
+      if( fg.type == COLORTYPE::DEFAULT ) fg = Color::basic( 0 );
+      if( bg.type == COLORTYPE::DEFAULT ) bg = Color::basic( 7 );
+    }
+
+    const size_t begin = buffer_.size();
+    buffer_.append( "<span style=\"" );
+    const size_t properties = buffer_.size();
+    if( fg.type != COLORTYPE::DEFAULT ) detail::append_color( buffer_, "color:", fg );
+    if( bg.type != COLORTYPE::DEFAULT ) detail::append_color( buffer_, "background-color:", bg );
+    if( any( style_.attrs & ATTR::BOLD ) ) buffer_.append( "font-weight:bold;" );
+    if( any( style_.attrs & ATTR::FAINT ) ) buffer_.append( "opacity:0.5;" );
+    if( any( style_.attrs & ATTR::ITALICS ) ) buffer_.append( "font-style:italic;" );
+    if( any( style_.attrs & ATTR::INVISIBLE ) ) buffer_.append( "visibility:hidden;" );
+
+    const bool underlined = any( style_.attrs & ( ATTR::UNDERLINED | ATTR::D_UNDERLINED ) ), crossed = any( style_.attrs & ATTR::CROSSED );
+    if( underlined || crossed )
+    {
+      buffer_.append( "text-decoration:" ).append( underlined ? "underline" : "" ).append( underlined && crossed ? " " : "" ).append( crossed ? "line-through;" : ";" );
+      if( any( style_.attrs & ATTR::D_UNDERLINED ) ) buffer_.append( "text-decoration-style:double;" );
+    }
+
+    // Attributes without a CSS equivalent, e.g. blink, need no span
+    if( buffer_.size() == properties )
+    {
+      buffer_.resize( begin );
+      return;
+    }
+
+    // The last ';' is not needed
+    buffer_.back() = '"';
+    buffer_.push_back( '>' );
+
+    span_style_ = style_;
+    span_open_ = true;
+  }
+
+  // close_span
+  /**
+   * @brief Closes the open span, if any.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::close_span()
+  {
+    if( span_open_ )
+    {
+      buffer_.append( "</span>" );
+      span_open_ = false;
+    }
+  }
+
+  // flush_buffer
+  /**
+   * @brief Writes the buffered output to the stream.
+   *
+   */
+  OSMANIP_INLINE void HtmlConverter::flush_buffer()
+  {
+    out_.write( buffer_.data(), static_cast<std::streamsize>( buffer_.size() ) );
+    buffer_.clear();
+  }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // ansi_to_html
+  /**
+   * @brief Converts a string containing escape sequences to HTML, see HtmlConverter.
+   *
+   * @param str the string to be converted.
+   *
+   * @return the HTML markup.
+   *
+   */
+  OSMANIP_INLINE std::string ansi_to_html( std::string_view str )
+  {
+    std::ostringstream out;
+    HtmlConverter converter( out );
+    converter.feed( str );
+    converter.end();
+    return out.str();
+  }
+
+}      // namespace osm
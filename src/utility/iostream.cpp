@@ -26,9 +26,9 @@ namespace osm
   //     Global variables
   //====================================================
 
-  Ostreambuf cout_buf{ &std::cout };      // NOLINT(cppcoreguidelines-interfaces-global-init)
-  std::ostream cout( &cout_buf );               /// Link to osm::cout
+  OSMANIP_INLINE Ostreambuf cout_buf{ &std::cout };      // NOLINT(cppcoreguidelines-interfaces-global-init)
+  OSMANIP_INLINE std::ostream cout( &cout_buf );               /// Link to osm::cout
 
-  OutputRedirector redirout{};
+  OSMANIP_CONSTINIT OSMANIP_INLINE LazyOutputRedirector redirout;
 
 }      // namespace osm
\ No newline at end of file
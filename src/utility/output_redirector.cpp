@@ -12,21 +12,28 @@
 //     Headers
 //====================================================
 
+// Platform headers
+#ifndef _WIN32
+#include <signal.h>
+#endif
+
 // My headers
 #include <osmanip/utility/output_redirector.hpp>
 #include <osmanip/utility/iostream.hpp>
-#include <osmanip/utility/strings.hpp>
 #include <osmanip/utility/sstream.hpp>
 
-// External headers
-#include <arsenalgear/utils.hpp>
-
 // STD headers
 #include <stdexcept>
 #include <mutex>
 #include <filesystem>
 #include <sstream>
+#include <system_error>
 #include <utility>
+#include <chrono>
+#include <csignal>
+#include <iterator>
+#include <algorithm>
+#include <thread>
 
 namespace osm
 {
@@ -34,12 +41,136 @@ namespace osm
 //   OutputRedirector redirout;
 
   //====================================================
-  //     Constant variables
+  //     Variables
+  //====================================================
+
+  namespace detail
+  {
+    // The name of the output file, usable before the static members are initialized
+    OSMANIP_STATIC constexpr const char * default_filename = "redirected_output.txt";
+
+    // The values of the default static members, computed the first time they are used
+    OSMANIP_STATIC const std::string & default_filename_string()
+    {
+      static const std::string filename = default_filename;
+      return filename;
+    }
+
+    OSMANIP_STATIC const std::string & default_filepath()
+    {
+      static const std::string filepath = ( fs::path( OutputRedirector::defaultFileDir() ) / default_filename ).string();
+      return filepath;
+    }
+
+    // The global redirector, published while it is alive
+    OSMANIP_STATIC std::atomic<OutputRedirector *> redirector_instance { nullptr };
+
+    // AsyncSlots
+    /**
+     * @brief Slots of the redirectors with a running writer thread, drained on fatal signals. A block is added when all the slots are taken and is never freed, so that a signal handler can always walk them.
+     *
+     */
+    struct AsyncSlots
+    {
+      std::atomic<OutputRedirector *> slots[ 8 ];
+      std::atomic<AsyncSlots *> next;
+    };
+    OSMANIP_STATIC AsyncSlots async_redirectors {};
+    OSMANIP_STATIC std::mutex async_mutex;      // Guards the slots and the signal handlers, taken after the queue mutex of a redirector
+    OSMANIP_STATIC size_t async_writers = 0;     // Number of running writer threads
+
+    // The signals on which the writer threads are drained, and their previous handlers
+    OSMANIP_STATIC constexpr int drained_signals[] = { SIGABRT, SIGFPE, SIGILL, SIGINT, SIGSEGV, SIGTERM };
+#ifdef _WIN32
+    OSMANIP_STATIC void ( *previous_handlers[ std::size( drained_signals ) ] )( int ) = {};
+#else
+    OSMANIP_STATIC struct sigaction previous_handlers[ std::size( drained_signals ) ] = {};
+#endif
+
+    // How long a fatal signal waits for the writer threads
+    OSMANIP_STATIC constexpr std::chrono::milliseconds signal_drain_timeout { 1000 };
+
+    // signal_index
+    /**
+     * @brief Returns the index of a drained signal.
+     *
+     */
+    OSMANIP_STATIC size_t signal_index( int signal )
+    {
+      return static_cast<size_t>( std::find( std::begin( drained_signals ), std::end( drained_signals ), signal ) - std::begin( drained_signals ) );
+    }
+
+    // chain_signal
+    /**
+     * @brief Calls the handler which was installed before the one of the redirectors, with its own signature, or, if it was the default one, raises the signal again.
+     *
+     */
+#ifdef _WIN32
+    OSMANIP_STATIC void chain_signal( int signal )
+    {
+      void ( *previous )( int ) = previous_handlers[ signal_index( signal ) ];
+      if( previous == SIG_IGN )
+      {
+        return;
+      }
+      if( previous && previous != SIG_DFL && previous != SIG_ERR )
+      {
+        previous( signal );
+        return;
+      }
+      std::signal( signal, SIG_DFL );
+      std::raise( signal );
+    }
+#else
+    OSMANIP_STATIC void chain_signal( int signal, siginfo_t * info, void * context )
+    {
+      const struct sigaction & previous = previous_handlers[ signal_index( signal ) ];
+      if( previous.sa_flags & SA_SIGINFO )
+      {
+        previous.sa_sigaction( signal, info, context );
+        return;
+      }
+      if( previous.sa_handler == SIG_IGN )
+      {
+        return;
+      }
+      if( previous.sa_handler != SIG_DFL )
+      {
+        previous.sa_handler( signal );
+        return;
+      }
+
+      // The signal is blocked while it is handled, so the default action takes place when the handler returns
+      sigaction( signal, &previous, nullptr );
+      raise( signal );
+    }
+#endif
+  }      // namespace detail
+
+  //====================================================
+  //     Static public members
   //====================================================
 
-  const std::string OutputRedirector::DEFAULT_FILENAME = "redirected_output.txt";
-  const std::string OutputRedirector::DEFAULT_FILE_DIR = fs::current_path().string();
-  const std::string OutputRedirector::DEFAULT_FILEPATH = DEFAULT_FILE_DIR + DEFAULT_FILENAME;
+  OSMANIP_INLINE const LazyString OutputRedirector::DEFAULT_FILENAME( &detail::default_filename_string );
+  OSMANIP_INLINE const LazyString OutputRedirector::DEFAULT_FILE_DIR( &defaultFileDir );
+  OSMANIP_INLINE const LazyString OutputRedirector::DEFAULT_FILEPATH( &detail::default_filepath );
+
+  //====================================================
+  //     Static methods
+  //====================================================
+
+  // defaultFileDir
+  /**
+   * @brief Get the directory of the output file, i.e. the working directory the first time it is needed.
+   *
+   * @return string containing the directory of the output file.
+   *
+   */
+  OSMANIP_INLINE const std::string & OutputRedirector::defaultFileDir()
+  {
+    static const std::string file_dir = fs::current_path().string();
+    return file_dir;
+  }
 
   //====================================================
   //     Constructors and destructors
@@ -50,14 +181,26 @@ namespace osm
    * @brief Construct a new OutputRedirector object. Default constructor will set the main attributes to default values.
    *
    */
-  OutputRedirector::OutputRedirector():
+  OSMANIP_INLINE OutputRedirector::OutputRedirector():
    std::ostream( this ),
    Stringbuf(),
    enabled_( false ),
-   filename_( DEFAULT_FILENAME ),
-   filepath_( DEFAULT_FILEPATH ),
-   last_ansi_str_size_( 0 ),
-   last_ansi_str_index_( 0 )
+   tee_( false ),
+   styled_( false ),
+   filename_( detail::default_filename ),
+   screen_( SCREEN_WIDTH, SCREEN_HEIGHT ),
+   file_read_( false ),
+   committed_( 0 ),
+   file_size_( 0 ),
+   max_size_( 0 ),
+   rotated_files_( 1 ),
+   async_( false ),
+   policy_( OVERFLOW_POLICY::BLOCK ),
+   buffer_size_( DEFAULT_BUFFER_SIZE ),
+   stop_( false ),
+   handed_over_( 0 ),
+   written_( 0 ),
+   dropped_( 0 )
    {}
 
   // Parametric constructor
@@ -67,28 +210,41 @@ namespace osm
    * @param filename name of the output file.
    *
    */
-  OutputRedirector::OutputRedirector( std::string filename ):
+  OSMANIP_INLINE OutputRedirector::OutputRedirector( std::string filename ):
     std::ostream( this ),
     Stringbuf(),
    enabled_( false ),
+   tee_( false ),
+   styled_( false ),
    filename_( std::move( filename ) ),
-   filepath_( (fs::current_path() /= filename_).string() ),
-   last_ansi_str_size_( 0 ),
-   last_ansi_str_index_( 0 )
+   screen_( SCREEN_WIDTH, SCREEN_HEIGHT ),
+   file_read_( false ),
+   committed_( 0 ),
+   file_size_( 0 ),
+   max_size_( 0 ),
+   rotated_files_( 1 ),
+   async_( false ),
+   policy_( OVERFLOW_POLICY::BLOCK ),
+   buffer_size_( DEFAULT_BUFFER_SIZE ),
+   stop_( false ),
+   handed_over_( 0 ),
+   written_( 0 ),
+   dropped_( 0 )
    {}
 
   // Destructor
   /**
-   * @brief Destructs OutputRedirector object. If redirection is still enabled, the buffer is flushed before being destroyed.
+   * @brief Destructs OutputRedirector object. If redirection is still enabled, the buffer is flushed before being destroyed. The writer thread, if any, writes all the output handed over to it before being stopped.
    *
    */
-  OutputRedirector::~OutputRedirector()
+  OSMANIP_INLINE OutputRedirector::~OutputRedirector()
   {
     if( enabled_ )
     {
-      this->flush();
+      std::ostream::flush();
       enabled_ = false;
     }
+    stop_writer();
   }
 
   //====================================================
@@ -102,15 +258,76 @@ namespace osm
    * @param filename the filename of the output file.
    *
    */
-  void OutputRedirector::setFilename( const std::string & filename )
+  OSMANIP_INLINE void OutputRedirector::setFilename( const std::string & filename )
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
+    close_file();
+
     filename_ = filename;
-    filepath_ = DEFAULT_FILE_DIR + filename_;
+    filepath_.clear();
+    screen_.reset();
+    file_read_ = false;
+  }
+
+  // setAsync
+  /**
+   * @brief Enables or disables asynchronous mode. When enabled, a flush only copies the output to a buffer and returns, while a writer thread renders the output and writes the file. When disabled, the output waiting for the writer is written first. Should not be called while other threads are writing to the redirector.
+   *
+   * @param async true to enable asynchronous mode.
+   * @param buffer_size maximum size of the output waiting for the writer thread. A larger single flush is still accepted when nothing is waiting.
+   * @param policy what a flush does when the buffer is full, see OVERFLOW_POLICY.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::setAsync( bool async, size_t buffer_size, OVERFLOW_POLICY policy )
+  {
+    if( !async )
+    {
+      stop_writer();
+    }
 
-    output_str_.clear();
-    last_ansi_str_index_ = 0;
-    last_ansi_str_size_ = 0;
+    std::scoped_lock<std::mutex> qlock { queue_mutex_ };
+    buffer_size_ = buffer_size;
+    policy_ = policy;
+    async_ = async;
+  }
+
+  // setTee
+  /**
+   * @brief Enables or disables tee mode. While redirection is enabled, the output of osm::cout is then also written, escape sequences included, to the stream of osm::cout, while the file receives the rendered text as usual. Each chunk is formatted once and only its bytes are copied.
+   *
+   * @param tee true to enable tee mode.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::setTee( bool tee )
+  {
+    tee_ = tee;
+  }
+
+  // setStyled
+  /**
+   * @brief Enables or disables styled mode. The file then keeps the colors and styles of the rendered text: each line is written with the SGR sequences of the styles of its cells, starting from the default style and going back to it at its end, so that the file can be displayed in a terminal or converted with HtmlConverter. It should be set before the output it applies to is written.
+   *
+   * @param styled true to enable styled mode.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::setStyled( bool styled )
+  {
+    styled_ = styled;
+  }
+
+  // setMaxSize
+  /**
+   * @brief Caps the size of the file. Once it is exceeded, provided at least half of the file can no longer change, the file is renamed appending ".1" to its name, the previous rotated files being renamed ".2", ".3" and so on, and a new file is started with the lines of the screen. The rotation is done by the thread writing the file, i.e. the writer thread in asynchronous mode. The lines of the screen always stay in the current file, so the limit should be well above their size. If the file cannot be rotated, the output keeps being appended to it and the rotation is tried again at the next flush.
+   *
+   * @param max_size the maximum size of the file, 0 for no limit.
+   * @param rotated_files the number of rotated files kept, the oldest one being deleted. With 0, the old output is deleted.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::setMaxSize( uintmax_t max_size, size_t rotated_files )
+  {
+    std::scoped_lock<std::mutex> slock { this->getMutex() };
+    max_size_ = max_size;
+    rotated_files_ = rotated_files;
   }
 
   //   void OutputRedirector::setFilepath( fs::path & path )
@@ -130,7 +347,7 @@ namespace osm
    * @return string containing the filename of the output file.
    *
    */
-  std::string & OutputRedirector::getFilename()
+  OSMANIP_INLINE std::string & OutputRedirector::getFilename()
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
     return filename_;
@@ -138,17 +355,33 @@ namespace osm
 
   // getFilepath
   /**
-   * @brief Get the name of the path to the output file.
+   * @brief Get the name of the path to the output file. The path is only computed when it is first asked for.
    *
    * @return string containing the name of the path to the output file.
    *
    */
-  std::string & OutputRedirector::getFilepath()
+  OSMANIP_INLINE std::string & OutputRedirector::getFilepath()
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
+    if( filepath_.empty() )
+    {
+      filepath_ = ( fs::path( defaultFileDir() ) / filename_ ).string();
+    }
     return filepath_;
   }
 
+  // getDroppedSize
+  /**
+   * @brief Get the size of the output discarded so far because the buffer of the writer thread was full, see OVERFLOW_POLICY::DROP.
+   *
+   * @return the number of discarded characters.
+   *
+   */
+  OSMANIP_INLINE size_t OutputRedirector::getDroppedSize()
+  {
+    return dropped_;
+  }
+
   //====================================================
   //     Methods
   //====================================================
@@ -160,7 +393,7 @@ namespace osm
    * @throws std::runtime_error if redirection is already enabled.
    *
    */
-  void OutputRedirector::begin()
+  OSMANIP_INLINE void OutputRedirector::begin()
   {
     sanity_check( "begin" );
     enabled_ = true;
@@ -168,16 +401,41 @@ namespace osm
 
   // end
   /**
-   * @brief Flushes the buffer and disables output redirection.
+   * @brief Flushes the buffer, waits for the writer thread to write all the output, if asynchronous, then closes the file and disables output redirection.
    *
    * @throws std::runtime_error if redirection is currently not enabled.
+   * @throws std::invalid_argument if the writer thread could not open the file.
    *
    */
-  void OutputRedirector::end()
+  OSMANIP_INLINE void OutputRedirector::end()
   {
     sanity_check( "end" );
     cout.flush();
     enabled_ = false;
+    stop_writer();
+
+    {
+      std::scoped_lock<std::mutex> slock { this->getMutex() };
+      close_file();
+    }
+    check_error();
+  }
+
+  // flush
+  /**
+   * @brief Flushes the buffer. In asynchronous mode, it also waits until the writer thread has written all the output handed over so far, so that it can be read from the file. Flushes through std::ostream, e.g. std::flush or those of osm::cout, do not wait.
+   *
+   * @throws std::invalid_argument if the writer thread could not open the file.
+   *
+   */
+  OSMANIP_INLINE OutputRedirector & OutputRedirector::flush()
+  {
+    std::ostream::flush();
+    if( async_ )
+    {
+      wait_written();
+    }
+    return *this;
   }
 
   // touch
@@ -187,19 +445,18 @@ namespace osm
    * @throws std::invalid_argument if the file cannot be opened.
    *
    */
-  void OutputRedirector::touch()
+  OSMANIP_INLINE void OutputRedirector::touch()
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
 
-    if( fstream_.open( filename_, std::fstream::in ); !fstream_.is_open() )
+    std::fstream file;
+    if( file.open( filename_, std::fstream::in ); !file.is_open() )
     {
-      if( fstream_.open( filename_, std::fstream::trunc | std::fstream::out ); !fstream_.is_open() )
+      if( file.open( filename_, std::fstream::trunc | std::fstream::out ); !file.is_open() )
       {
         exception_file_not_found();
       }
     }
-
-    fstream_.close();
   }
 
   // isEnabled
@@ -209,90 +466,667 @@ namespace osm
    * @return true if enabled. Otherwise, returns false.
    *
    */
-  bool OutputRedirector::isEnabled()
+  OSMANIP_INLINE bool OutputRedirector::isEnabled()
   {
     return enabled_;
   }
 
+  // isTee
+  /**
+   * @brief Returns whether the redirected output of osm::cout is also written to its stream, see setTee.
+   *
+   * @return true if tee mode is enabled. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool OutputRedirector::isTee()
+  {
+    return tee_;
+  }
+
+  // isStyled
+  /**
+   * @brief Returns whether the file keeps the styles of the text, see setStyled.
+   *
+   * @return true if styled mode is enabled. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool OutputRedirector::isStyled()
+  {
+    return styled_;
+  }
+
+  // isAsync
+  /**
+   * @brief Returns whether the output is written by a writer thread, see setAsync.
+   *
+   * @return true if asynchronous mode is enabled. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool OutputRedirector::isAsync()
+  {
+    return async_;
+  }
+
   //====================================================
   //     Private methods
   //====================================================
 
   // sync
   /**
-   * @brief Responsible for calling the appropriate output update functions and writing the result to the file.
+   * @brief Responsible for calling the appropriate output update functions and writing the result to the file. In asynchronous mode, the output is handed over to the writer thread instead.
    *
    * @return the error state of the stream buffer
    *
    */
-  int32_t OutputRedirector::sync()
+  OSMANIP_INLINE int32_t OutputRedirector::sync()
   {
-    // Verify file is available
-    touch();
+    if( async_ )
+    {
+      hand_over();
+      return 0;
+    }
 
     std::scoped_lock<std::mutex> slock { this->getMutex() };
 
-    read_file();
+    if( !fstream_.is_open() )
+    {
+      open_file();
+    }
     prepare_output();
     write_output();
 
     return fstream_.rdstate();
   }
 
-  // prepare_output
+  // open_file
   /**
-   * @brief Updates and formats the output string and clears the buffer.
+   * @brief Opens the file, creating it if needed. A file left unchanged since it was closed is resumed, otherwise its final lines are read again so that the output is rendered after them.
+   *
+   * @throws std::invalid_argument if the file cannot be opened.
    *
    */
-  void OutputRedirector::prepare_output()
+  OSMANIP_INLINE void OutputRedirector::open_file()
   {
-    output_str_ << this << std::flush;
+    std::error_code error;
+    if( const uintmax_t size = fs::file_size( filename_, error ); error || size != file_size_ )
+    {
+      screen_.reset();
+      file_read_ = false;
+    }
+
+    constexpr auto mode = std::fstream::in | std::fstream::out | std::fstream::binary;
+    if( fstream_.open( filename_, mode ); !fstream_.is_open() )
+    {
+      if( fstream_.open( filename_, mode | std::fstream::trunc ); !fstream_.is_open() )
+      {
+        exception_file_not_found();
+        return;
+      }
+    }
 
-    if( agr::is_escape( this->str(), agr::ANSI::generic ) )
+    if( !file_read_ )
     {
-      output_str_.str( get_formatted_from_ansi( output_str_.str(), &last_ansi_str_index_, &last_ansi_str_size_ ) );
+      read_file();
     }
+  }
+
+  // close_file
+  /**
+   * @brief Closes the file, if open, after removing the padding of its lines. The rendered output is kept, so that the file can be resumed.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::close_file()
+  {
+    if( fstream_.is_open() )
+    {
+      const auto padded = std::find_if( live_.begin(), live_.end(), []( const LiveLine & line ) { return line.reserved != line.text.size(); } );
+      if( padded != live_.end() )
+      {
+        rewrite_lines( static_cast<size_t>( padded - live_.begin() ) );
+      }
+      fstream_.close();
+    }
+    fstream_.clear();
+  }
+
+  // prepare_output
+  /**
+   * @brief Renders the buffer on the screen, as a terminal would display it, and clears the buffer.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::prepare_output()
+  {
+    screen_.write( this->str() );
     this->str( "" );
   }
 
   // write_output
   /**
-   * @brief Writes the output string to the file. The file will be cleared before the string is written.
+   * @brief Writes the lines which scrolled off the screen and the lines of the screen after the final part of the file. Only these lines and the rows changed since the previous flush are rendered: each one is compared with the line written at its place, and a changed line is overwritten in place if it fits the characters reserved for it, otherwise it is rewritten together with the following lines. Lines which scrolled off are written without padding, since they can no longer change.
    *
-   * @throws std::invalid_argument if there is a problem opening the file.
+   */
+  OSMANIP_INLINE void OutputRedirector::write_output()
+  {
+    const std::deque<ScreenLine> & scrollback = screen_.scrollback();
+    const size_t scrolled = scrollback.size();
+    const size_t count = scrolled + screen_.usedRows();
+    const RowRange changed = screen_.takeChangedRows();
+    const auto line_at = [ & ]( size_t i ) -> const ScreenLine & { return i < scrolled ? scrollback[ i ] : screen_.line( i - scrolled ); };
+
+    // The first line which cannot be overwritten in place, if any, is rewritten with the following ones
+    size_t first = count;
+    for( size_t i = 0; i < count; ++i )
+    {
+      if( i == live_.size() )
+      {
+        first = i;
+        break;
+      }
+
+      const bool final = i < scrolled;
+      if( !final && ( i - scrolled < changed.first || i - scrolled >= changed.last ) )
+      {
+        continue;
+      }
+
+      LiveLine & live = live_[ i ];
+      const ScreenLine & line = line_at( i );
+      output_.clear();
+      Screen::appendLine( output_, line, styled_ );
+      if( output_ == live.text && line.wrapped == live.wrapped && !( final && live.reserved != output_.size() ) )
+      {
+        continue;
+      }
+      if( final || i + 1 == live_.size() || line.wrapped || live.wrapped || output_.size() > live.reserved )
+      {
+        first = i;
+        break;
+      }
+
+      fstream_.seekp( static_cast<std::streamoff>( live.offset ) );
+      fstream_.write( output_.data(), static_cast<std::streamsize>( output_.size() ) );
+      std::fill_n( std::ostreambuf_iterator<char>( fstream_ ), live.reserved - output_.size(), ' ' );
+      live.text.swap( output_ );
+    }
+
+    // With fewer lines than before, the new last line loses its padding and its new line
+    if( first == count && count < live_.size() )
+    {
+      first = count - 1;
+    }
+    if( first < count )
+    {
+      live_.resize( count );
+      for( size_t i = first; i < count; ++i )
+      {
+        live_[ i ].text.clear();
+        Screen::appendLine( live_[ i ].text, line_at( i ), styled_ );
+        live_[ i ].wrapped = line_at( i ).wrapped;
+      }
+      rewrite_lines( first );
+    }
+    fstream_.flush();
+
+    screen_.dropScrollback();
+    live_.erase( live_.begin(), live_.begin() + static_cast<ptrdiff_t>( scrolled ) );
+    committed_ = live_.front().offset;
+
+    if( max_size_ > 0 && file_size_ > max_size_ && committed_ >= max_size_ / 2 )
+    {
+      rotate_file();
+    }
+  }
+
+  // rotate_file
+  /**
+   * @brief Moves the final part of the file to the first rotated file, shifting the other ones, and writes the lines of the screen to a new file. The contents of the file are never read back. If the file cannot be moved or removed, e.g. without permissions or while another process holds it, it is left as it is and the output keeps being appended to it.
    *
    */
-  void OutputRedirector::write_output()
+  OSMANIP_INLINE void OutputRedirector::rotate_file()
   {
-    if( fstream_.open( filename_, std::fstream::trunc | std::fstream::out ); !fstream_.is_open() )
+    std::error_code error, ignored;
+    fstream_.close();
+
+    const auto rotated = [ this ]( size_t index ) { return filename_ + "." + std::to_string( index ); };
+    if( rotated_files_ == 0 )
+    {
+      fs::remove( filename_, error );
+    }
+    else
+    {
+      // Missing rotated files are expected until there are enough of them
+      for( size_t index = rotated_files_; index > 1; --index )
+      {
+        fs::rename( rotated( index - 1 ), rotated( index ), ignored );
+      }
+
+      // If the lines of the screen cannot be removed, they are only repeated in the new file
+      if( fs::rename( filename_, rotated( 1 ), error ); !error )
+      {
+        fs::resize_file( rotated( 1 ), committed_, ignored );
+      }
+    }
+
+    constexpr auto mode = std::fstream::in | std::fstream::out | std::fstream::binary;
+    fstream_.clear();
+    fstream_.open( filename_, error ? mode : mode | std::fstream::trunc );
+    if( !fstream_.is_open() )
     {
       exception_file_not_found();
       return;
     }
+    if( error )
+    {
+      return;
+    }
 
-    fstream_ << output_str_.rdbuf() << std::flush;
-    fstream_.close();
+    committed_ = 0;
+    file_size_ = 0;
+    rewrite_lines( 0 );
+  }
+
+  // rewrite_lines
+  /**
+   * @brief Writes the lines from the given one on, without padding, after the previous line and its new line. The file is truncated after the last line.
+   *
+   * @param first the index of the first line to be written.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::rewrite_lines( size_t first )
+  {
+    uintmax_t offset = committed_;
+    if( first > 0 )
+    {
+      const LiveLine & previous = live_[ first - 1 ];
+      offset = previous.offset + previous.reserved;
+      fstream_.seekp( static_cast<std::streamoff>( offset ) );
+      if( !previous.wrapped )
+      {
+        fstream_.put( '\n' );
+        ++offset;
+      }
+    }
+    else
+    {
+      fstream_.seekp( static_cast<std::streamoff>( offset ) );
+    }
+
+    for( size_t i = first; i < live_.size(); ++i )
+    {
+      LiveLine & line = live_[ i ];
+      line.offset = offset;
+      line.reserved = line.text.size();
+
+      fstream_.write( line.text.data(), static_cast<std::streamsize>( line.text.size() ) );
+      offset += line.text.size();
+      if( i + 1 < live_.size() && !line.wrapped )
+      {
+        fstream_.put( '\n' );
+        ++offset;
+      }
+    }
+    fstream_.flush();
+
+    if( offset < file_size_ )
+    {
+      std::error_code error;
+      fs::resize_file( filename_, offset, error );
+    }
+    file_size_ = offset;
   }
 
   // read_file
   /**
-   * @brief Reads the file and stores its entire contents.
+   * @brief Reads the final lines of the open file, the ones the cursor can move back over, so that the output is rendered after them. The earlier contents are never read nor written again. If the final lines are not rendered as they are written, e.g. since they hold escape sequences, the output is only appended to the file.
    *
-   * @throws std::invalid_argument if there is a problem opening the file.
+   */
+  OSMANIP_INLINE void OutputRedirector::read_file()
+  {
+    fstream_.seekg( 0, std::fstream::end );
+    const uintmax_t size = static_cast<uintmax_t>( std::max<std::streamoff>( fstream_.tellg(), 0 ) );
+
+    // The file is read backwards until the start of its last SCREEN_HEIGHT lines, or of the last whole line within the limit
+    constexpr size_t chunk_size = 64 * 1024;
+    const uintmax_t limit = size - std::min<uintmax_t>( size, SCREEN_WIDTH * SCREEN_HEIGHT );
+    std::string tail;
+    uintmax_t start = size;
+    size_t lines = 0;
+    while( start > limit && lines < SCREEN_HEIGHT )
+    {
+      const size_t chunk = static_cast<size_t>( std::min<uintmax_t>( start - limit, chunk_size ) );
+      start -= chunk;
+      tail.insert( 0, chunk, '\0' );
+      fstream_.seekg( static_cast<std::streamoff>( start ) );
+      fstream_.read( tail.data(), static_cast<std::streamsize>( chunk ) );
+      for( size_t i = chunk; i-- > 0; )
+      {
+        if( tail[ i ] == '\n' && ++lines == SCREEN_HEIGHT )
+        {
+          tail.erase( 0, i + 1 );
+          start += i + 1;
+          break;
+        }
+      }
+    }
+    if( lines < SCREEN_HEIGHT && start > 0 )
+    {
+      const size_t newline = tail.find( '\n' );
+      const size_t skipped = newline == std::string::npos ? tail.size() : newline + 1;
+      tail.erase( 0, skipped );
+      start += skipped;
+    }
+    fstream_.clear();
+
+    // The lines are placed where the next flush would write them
+    screen_.write( tail );
+    const std::deque<ScreenLine> & scrollback = screen_.scrollback();
+    const size_t scrolled = scrollback.size();
+    const size_t count = scrolled + screen_.usedRows();
+    std::string rendered;
+    uintmax_t offset = start;
+    live_.assign( count, LiveLine() );
+    for( size_t i = 0; i < count; ++i )
+    {
+      const ScreenLine & line = i < scrolled ? scrollback[ i ] : screen_.line( i - scrolled );
+      LiveLine & live = live_[ i ];
+      Screen::appendLine( live.text, line, styled_ );
+      live.offset = offset;
+      live.reserved = live.text.size();
+      live.wrapped = line.wrapped;
+
+      rendered += live.text;
+      offset += live.text.size();
+      if( i + 1 < count && !line.wrapped )
+      {
+        rendered += '\n';
+        ++offset;
+      }
+    }
+    screen_.dropScrollback();
+    screen_.takeChangedRows();
+
+    if( rendered == tail && count > scrolled )
+    {
+      live_.erase( live_.begin(), live_.begin() + static_cast<ptrdiff_t>( scrolled ) );
+      committed_ = live_.front().offset;
+    }
+    else
+    {
+      screen_.reset();
+      live_.clear();
+      committed_ = size;
+    }
+    file_size_ = size;
+    file_read_ = true;
+  }
+
+  // hand_over
+  /**
+   * @brief Moves the buffer to the output waiting for the writer thread, starting the thread if needed. If the waiting output would exceed the buffer size, the producer waits for the writer to take it or the output is discarded, depending on the policy.
    *
    */
-  void OutputRedirector::read_file()
+  OSMANIP_INLINE void OutputRedirector::hand_over()
   {
-    if( fstream_.open( filename_, std::fstream::in ); !fstream_.is_open() )
+    // The end of the read area is only moved on overflow, so in_avail() can miss the last output
+    const std::streamsize size = this->pptr() - this->gptr();
+    if( size <= 0 )
     {
-      exception_file_not_found();
       return;
     }
-    else
+
+    std::unique_lock<std::mutex> qlock { queue_mutex_ };
+    const auto has_room = [ this, size ] { return pending_.empty() || pending_.size() + static_cast<size_t>( size ) <= buffer_size_; };
+    if( policy_ == OVERFLOW_POLICY::DROP && !has_room() )
     {
-      output_str_.str( "" );
-      fstream_ >> output_str_.rdbuf();
-      fstream_.close();
+      dropped_ += static_cast<size_t>( size );
+      this->str( "" );
+      return;
+    }
+    done_cv_.wait( qlock, has_room );
+
+    const size_t begin = pending_.size();
+    pending_.resize( begin + static_cast<size_t>( size ) );
+    this->sgetn( pending_.data() + begin, size );
+    this->str( "" );
+    ++handed_over_;
+
+    if( !writer_.joinable() )
+    {
+      start_writer();
+    }
+    queue_cv_.notify_one();
+  }
+
+  // start_writer
+  /**
+   * @brief Starts the writer thread and registers the redirector to be drained on fatal signals. The signal handlers are installed when the first writer is started. The calling thread is expected to own the queue mutex.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::start_writer()
+  {
+    std::scoped_lock<std::mutex> alock { detail::async_mutex };
+    std::atomic<OutputRedirector *> * free_slot = nullptr;
+    for( detail::AsyncSlots * block = &detail::async_redirectors; !free_slot; block = block->next )
+    {
+      for( auto & slot: block->slots )
+      {
+        if( !slot.load() )
+        {
+          free_slot = &slot;
+          break;
+        }
+      }
+      if( !free_slot && !block->next )
+      {
+        block->next = new detail::AsyncSlots {};
+      }
+    }
+
+    writer_ = std::thread( &OutputRedirector::writer_loop, this );
+    *free_slot = this;
+    if( detail::async_writers++ == 0 )
+    {
+      set_signal_handlers( true );
+    }
+  }
+
+  // stop_writer
+  /**
+   * @brief Stops the writer thread, if running, once it has written all the output handed over to it.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::stop_writer()
+  {
+    std::thread writer;
+    {
+      std::scoped_lock<std::mutex> qlock { queue_mutex_ };
+      if( !writer_.joinable() )
+      {
+        return;
+      }
+      stop_ = true;
+      writer = std::move( writer_ );
+    }
+    queue_cv_.notify_one();
+    writer.join();
+
+    std::scoped_lock<std::mutex> qlock { queue_mutex_ }, alock { detail::async_mutex };
+    stop_ = false;
+    for( detail::AsyncSlots * block = &detail::async_redirectors; block; block = block->next )
+    {
+      for( auto & slot: block->slots )
+      {
+        if( slot.load() == this )
+        {
+          slot = nullptr;
+        }
+      }
+    }
+
+    if( --detail::async_writers == 0 )
+    {
+      set_signal_handlers( false );
+    }
+  }
+
+  // writer_loop
+  /**
+   * @brief Body of the writer thread: swaps the buffers, so that the producers can go on with an empty one, then renders and writes the output as sync() does. An error is stored and thrown by the next flush() or end().
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::writer_loop()
+  {
+    std::unique_lock<std::mutex> qlock { queue_mutex_ };
+    while( true )
+    {
+      queue_cv_.wait( qlock, [ this ] { return !pending_.empty() || stop_; } );
+      if( pending_.empty() )
+      {
+        return;
+      }
+
+      writing_.swap( pending_ );
+      const uint64_t batch = handed_over_;
+      qlock.unlock();
+      done_cv_.notify_all();
+
+      std::exception_ptr error;
+      try
+      {
+        std::scoped_lock<std::mutex> slock { this->getMutex() };
+        if( !fstream_.is_open() )
+        {
+          open_file();
+        }
+        screen_.write( writing_ );
+        write_output();
+      }
+      catch( ... )
+      {
+        error = std::current_exception();
+      }
+      writing_.clear();
+
+      qlock.lock();
+      if( error )
+      {
+        error_ = error;
+      }
+      written_ = batch;
+      done_cv_.notify_all();
+    }
+  }
+
+  // wait_written
+  /**
+   * @brief Waits until the writer thread has written all the output handed over so far.
+   *
+   * @throws std::invalid_argument if the writer thread could not open the file.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::wait_written()
+  {
+    {
+      std::unique_lock<std::mutex> qlock { queue_mutex_ };
+      const uint64_t target = handed_over_;
+      done_cv_.wait( qlock, [ this, target ] { return written_ >= target; } );
+    }
+    check_error();
+  }
+
+  // check_error
+  /**
+   * @brief Throws the error met by the writer thread, if any, and clears it.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::check_error()
+  {
+    std::exception_ptr error;
+    {
+      std::scoped_lock<std::mutex> qlock { queue_mutex_ };
+      error = std::exchange( error_, nullptr );
+    }
+    if( error )
+    {
+      std::rethrow_exception( error );
+    }
+  }
+
+  // set_signal_handlers
+  /**
+   * @brief Installs the handlers of fatal signals, saving the previous ones, or restores the previous ones. A handler installed after those of the redirectors is left in place. The handlers wait for the writer threads, see drain_writers, then call the previous handler with its own signature: with sigaction on POSIX systems, so that a handler taking the signal information gets it. The calling thread is expected to own the mutex of the asynchronous redirectors.
+   *
+   * @param install true to install the handlers, false to restore the previous ones.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::set_signal_handlers( bool install )
+  {
+#ifdef _WIN32
+    void ( *handler )( int ) = []( int signal )
+    {
+      drain_writers();
+      detail::chain_signal( signal );
+    };
+
+    for( size_t i = 0; i < std::size( detail::drained_signals ); i++ )
+    {
+      const int signal = detail::drained_signals[ i ];
+      if( install )
+      {
+        detail::previous_handlers[ i ] = std::signal( signal, handler );
+      }
+      else if( void ( *current )( int ) = std::signal( signal, detail::previous_handlers[ i ] ); current != handler )
+      {
+        std::signal( signal, current );
+      }
+    }
+#else
+    void ( *handler )( int, siginfo_t *, void * ) = []( int signal, siginfo_t * info, void * context )
+    {
+      drain_writers();
+      detail::chain_signal( signal, info, context );
+    };
+
+    for( size_t i = 0; i < std::size( detail::drained_signals ); i++ )
+    {
+      const int signal = detail::drained_signals[ i ];
+      if( install )
+      {
+        struct sigaction action {};
+        action.sa_sigaction = handler;
+        action.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset( &action.sa_mask );
+        sigaction( signal, &action, &detail::previous_handlers[ i ] );
+      }
+      else if( struct sigaction current {}; sigaction( signal, nullptr, &current ) == 0 && ( current.sa_flags & SA_SIGINFO ) && current.sa_sigaction == handler )
+      {
+        sigaction( signal, &detail::previous_handlers[ i ], nullptr );
+      }
+    }
+#endif
+  }
+
+  // drain_writers
+  /**
+   * @brief Called by the handlers of fatal signals: waits, for a bounded time, until the running writer threads have written the output handed over to them. Only atomics are used, since locks could be held by the interrupted thread.
+   *
+   */
+  OSMANIP_INLINE void OutputRedirector::drain_writers()
+  {
+    const auto deadline = std::chrono::steady_clock::now() + detail::signal_drain_timeout;
+    for( const detail::AsyncSlots * block = &detail::async_redirectors; block; block = block->next )
+    {
+      for( const auto & slot: block->slots )
+      {
+        if( const OutputRedirector * redirector = slot.load() )
+        {
+          const uint64_t target = redirector->handed_over_;
+          while( redirector->written_ < target && std::chrono::steady_clock::now() < deadline )
+          {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+          }
+        }
+      }
     }
   }
 
@@ -304,7 +1138,7 @@ namespace osm
    * @throws std::invalid_argument if an unknown function name is used.
    *
    */
-  void OutputRedirector::sanity_check( const std::string & func_name )
+  OSMANIP_INLINE void OutputRedirector::sanity_check( const std::string & func_name )
   {
     if( func_name == "begin" )
     {
@@ -324,20 +1158,74 @@ namespace osm
 
   // exception_file_not_found
   /**
-   * @brief Throws an invalid_argument exception if the file was not found or could not be opened. It is important to note that the calling thread is excepted to own the mutex. Calling this function will retain ownership of the mutex and release it before throwing the exception.
+   * @brief Throws an invalid_argument exception if the file was not found or could not be opened. It is important to note that the calling thread is excepted to own the mutex, which is released by the lock of the caller while the exception propagates.
    *
    * @throws std::invalid_argument
    *
    */
-  void OutputRedirector::exception_file_not_found()
+  OSMANIP_INLINE void OutputRedirector::exception_file_not_found()
   {
-    std::string filename;
+    throw std::invalid_argument( std::string( "Could not open file " ) + "'" + filename_ + "'" );
+  }
+
+  // LazyOutputRedirector
+  //====================================================
+  //     Getters
+  //====================================================
+
+  // get
+  /**
+   * @brief Get the global redirector, creating it on first use. It is destroyed at exit like any other static object.
+   *
+   * @return the global OutputRedirector object.
+   *
+   */
+  OSMANIP_INLINE OutputRedirector & LazyOutputRedirector::get()
+  {
+    if( OutputRedirector * redirector = detail::redirector_instance.load( std::memory_order_acquire ) )
     {
-      std::scoped_lock<std::mutex> slock { std::adopt_lock, this->getMutex() };
-      filename = filename_;
+      return *redirector;
     }
 
-    throw std::invalid_argument( std::string( "Could not open file " ) + "'" + filename + "'" );
+    static struct Storage
+    {
+      OutputRedirector redirector;
+
+      Storage() { detail::redirector_instance.store( &redirector, std::memory_order_release ); }
+      ~Storage() { detail::redirector_instance.store( nullptr, std::memory_order_release ); }
+    } storage;
+
+    return storage.redirector;
+  }
+
+  //====================================================
+  //     Methods
+  //====================================================
+
+  // isEnabled
+  /**
+   * @brief Returns the current state of the global redirector, without creating it.
+   *
+   * @return true if the redirector exists and is enabled. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool LazyOutputRedirector::isEnabled() const
+  {
+    OutputRedirector * redirector = detail::redirector_instance.load( std::memory_order_acquire );
+    return redirector && redirector->isEnabled();
+  }
+
+  // isTee
+  /**
+   * @brief Returns whether the global redirector is in tee mode, without creating it.
+   *
+   * @return true if the redirector exists and is in tee mode. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool LazyOutputRedirector::isTee() const
+  {
+    OutputRedirector * redirector = detail::redirector_instance.load( std::memory_order_acquire );
+    return redirector && redirector->isTee();
   }
 
 }      // namespace osm
\ No newline at end of file
@@ -0,0 +1,1074 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file screen.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/screen.hpp>
+
+// STD headers
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    // append_utf8
+    /**
+     * @brief Appends the UTF-8 encoding of a character to a string.
+     *
+     */
+    OSMANIP_STATIC void append_utf8( std::string & str, char32_t ch )
+    {
+      if( ch < 0x80 )
+      {
+        str += static_cast<char>( ch );
+      }
+      else if( ch < 0x800 )
+      {
+        str += static_cast<char>( 0xC0 | ( ch >> 6 ) );
+        str += static_cast<char>( 0x80 | ( ch & 0x3F ) );
+      }
+      else if( ch < 0x10000 )
+      {
+        str += static_cast<char>( 0xE0 | ( ch >> 12 ) );
+        str += static_cast<char>( 0x80 | ( ( ch >> 6 ) & 0x3F ) );
+        str += static_cast<char>( 0x80 | ( ch & 0x3F ) );
+      }
+      else
+      {
+        str += static_cast<char>( 0xF0 | ( ch >> 18 ) );
+        str += static_cast<char>( 0x80 | ( ( ch >> 12 ) & 0x3F ) );
+        str += static_cast<char>( 0x80 | ( ( ch >> 6 ) & 0x3F ) );
+        str += static_cast<char>( 0x80 | ( ch & 0x3F ) );
+      }
+    }
+
+    // append_line
+    /**
+     * @brief Appends the text of a line to a string, without its trailing unwritten cells. A tab is appended as such if the cells it skipped are still blank, otherwise as a space. If styled, the SGR sequences of the styles of the cells are written before them, starting from the default style and going back to it at the end of the line.
+     *
+     */
+    OSMANIP_STATIC void append_line( std::string & str, const ScreenLine & line, bool styled = false )
+    {
+      const auto blank = []( const Cell & cell ) { return cell.ch == 0 && cell.control == 0; };
+      size_t size = line.cells.size();
+      while( size > 0 && blank( line.cells[ size - 1 ] ) )
+      {
+        --size;
+      }
+
+      Style current;
+      const auto use_style = [ & ]( const Style & style )
+      {
+        if( styled && style != current )
+        {
+          char sequence[ SGR_MAX_SIZE ];
+          str.append( sequence, write_sgr( sequence, current, style ) );
+          current = style;
+        }
+      };
+
+      for( size_t i = 0; i < size; ++i )
+      {
+        const Cell & cell = line.cells[ i ];
+        use_style( cell.style );
+        if( cell.control != 0 )
+        {
+          str += static_cast<char>( cell.control );
+        }
+
+        if( cell.ch == U'\t' )
+        {
+          const size_t stop = std::min( ( i / 8 + 1 ) * 8, size );
+          if( std::all_of( line.cells.begin() + static_cast<ptrdiff_t>( i + 1 ), line.cells.begin() + static_cast<ptrdiff_t>( stop ), blank ) )
+          {
+            str += '\t';
+            i = stop - 1;
+            continue;
+          }
+        }
+        if( cell.ch != 0 || i + 1 < size )
+        {
+          append_utf8( str, cell.ch != 0 && cell.ch != U'\t' ? cell.ch : U' ' );
+        }
+      }
+      use_style( Style() );
+
+      if( line.crlf )
+      {
+        str += '\r';
+      }
+    }
+  }      // namespace detail
+
+  //====================================================
+  //     Constructors
+  //====================================================
+
+  // Parametric constructor
+  /**
+   * @brief Construct a new Screen object, with the cursor in the top left corner.
+   *
+   * @param width the number of columns.
+   * @param height the number of rows.
+   * @param max_scrollback the maximum number of lines kept after they scroll off the top, by default all of them.
+   *
+   * @throws std::invalid_argument if the screen has no rows or no columns.
+   *
+   */
+  OSMANIP_INLINE Screen::Screen( size_t width, size_t height, size_t max_scrollback ):
+   width_( width ),
+   height_( height ),
+   max_scrollback_( max_scrollback )
+  {
+    if( width == 0 || height == 0 )
+    {
+      throw std::invalid_argument( "The screen must have at least one row and one column!" );
+    }
+
+    reset();
+  }
+
+  //====================================================
+  //     Methods
+  //====================================================
+
+  // write
+  /**
+   * @brief Interprets output as the terminal would. Data can be written in chunks of any size.
+   *
+   * @param data the output.
+   *
+   */
+  OSMANIP_INLINE void Screen::write( std::string_view data )
+  {
+    parser_.feed( data, *this );
+  }
+
+  // reset
+  /**
+   * @brief Clears the screen and the scrollback, and resets the cursor, the style and the scroll region.
+   *
+   */
+  OSMANIP_INLINE void Screen::reset()
+  {
+    lines_.assign( height_, ScreenLine() );
+    scrollback_.clear();
+
+    row_ = col_ = 0;
+    wrap_pending_ = false;
+    cr_pending_ = false;
+    saved_row_ = saved_col_ = 0;
+    saved_style_ = Style();
+    top_ = 0;
+    bottom_ = height_ - 1;
+    changed_ = RowRange { 0, height_ };
+
+    style_ = Style();
+    parser_.reset();
+
+    utf8_ch_ = 0;
+    utf8_left_ = 0;
+  }
+
+  // takeScrollback
+  /**
+   * @brief Moves the text of the scrollback to a string and clears the scrollback. Lines scrolled off the top can no longer change, so this is the final text of the output up to the screen; a wrapped line is not followed by a new line.
+   *
+   * @param out the string the text is appended to.
+   *
+   */
+  OSMANIP_INLINE void Screen::takeScrollback( std::string & out )
+  {
+    for( const auto & line: scrollback_ )
+    {
+      detail::append_line( out, line );
+      if( !line.wrapped )
+      {
+        out += '\n';
+      }
+    }
+    dropScrollback();
+  }
+
+  // dropScrollback
+  /**
+   * @brief Clears the scrollback, e.g. once its lines have been read with scrollback(). Their storage is reused by the following scrolls.
+   *
+   */
+  OSMANIP_INLINE void Screen::dropScrollback()
+  {
+    for( auto & line: scrollback_ )
+    {
+      if( spare_.size() < height_ )
+      {
+        spare_.push_back( std::move( line ) );
+      }
+    }
+    scrollback_.clear();
+  }
+
+  // takeChangedRows
+  /**
+   * @brief Returns the rows which may have changed since the last call, or since the screen was created or reset, and starts tracking the changes again. The lines moved to the scrollback in the meantime count as rows above the screen: a row outside the range holds the text held, at the last call, by the row as many lines below it as were moved to the scrollback. Scrolls which drop lines, e.g. beyond the maximum scrollback, change every row.
+   *
+   * @return the changed rows, an empty range if none.
+   *
+   */
+  OSMANIP_INLINE RowRange Screen::takeChangedRows()
+  {
+    return std::exchange( changed_, RowRange() );
+  }
+
+  // appendLine
+  /**
+   * @brief Appends the text of a line, of the screen or of the scrollback, to a string, without its trailing unwritten cells.
+   *
+   * @param out the string the text is appended to.
+   * @param line the line.
+   * @param styled if true, the text is preceded by the SGR sequences of the styles of its cells and followed by a reset if needed, so that each line can be displayed on its own.
+   *
+   */
+  OSMANIP_INLINE void Screen::appendLine( std::string & out, const ScreenLine & line, bool styled )
+  {
+    detail::append_line( out, line, styled );
+  }
+
+  //====================================================
+  //     Getters
+  //====================================================
+
+  // at
+  /**
+   * @brief Returns a cell of the screen.
+   *
+   * @param row the row of the cell.
+   * @param col the column of the cell.
+   *
+   * @return the cell, an empty one if it was never written.
+   *
+   * @throws std::out_of_range if the cell is out of the screen.
+   *
+   */
+  OSMANIP_INLINE Cell Screen::at( size_t row, size_t col ) const
+  {
+    if( row >= height_ || col >= width_ )
+    {
+      throw std::out_of_range( "The cell is out of the screen!" );
+    }
+
+    const std::vector<Cell> & cells = lines_[ row ].cells;
+    return col < cells.size() ? cells[ col ] : Cell();
+  }
+
+  // str
+  /**
+   * @brief Returns the text of the scrollback and of the screen, down to the last written line or to the cursor. Trailing unwritten cells are dropped, and wrapped lines are joined.
+   *
+   * @return the text, UTF-8 encoded.
+   *
+   */
+  OSMANIP_INLINE std::string Screen::str() const
+  {
+    std::string res;
+    for( const auto & line: scrollback_ )
+    {
+      detail::append_line( res, line );
+      if( !line.wrapped )
+      {
+        res += '\n';
+      }
+    }
+    appendScreen( res );
+
+    return res;
+  }
+
+  /**
+   * @brief Returns the text of a row of the screen, without its trailing unwritten cells.
+   *
+   * @param row the row.
+   *
+   * @return the text, UTF-8 encoded.
+   *
+   */
+  OSMANIP_INLINE std::string Screen::str( size_t row ) const
+  {
+    std::string res;
+    detail::append_line( res, lines_.at( row ) );
+    return res;
+  }
+
+  // appendScreen
+  /**
+   * @brief Appends the text of the screen to a string, down to the last written line or to the cursor, without the scrollback. Trailing unwritten cells are dropped, and wrapped lines are joined.
+   *
+   * @param out the string the text is appended to.
+   *
+   */
+  OSMANIP_INLINE void Screen::appendScreen( std::string & out ) const
+  {
+    const size_t used = usedRows();
+    for( size_t row = 0; row < used; ++row )
+    {
+      detail::append_line( out, lines_[ row ] );
+      if( row + 1 < used && !lines_[ row ].wrapped )
+      {
+        out += '\n';
+      }
+    }
+  }
+
+  // usedRows
+  /**
+   * @brief Returns the number of rows down to the last written line or to the cursor, i.e. the rows rendered by appendScreen.
+   *
+   */
+  OSMANIP_INLINE size_t Screen::usedRows() const
+  {
+    for( size_t row = height_; row-- > row_ + 1; )
+    {
+      if( !lines_[ row ].cells.empty() )
+      {
+        return row + 1;
+      }
+    }
+    return row_ + 1;
+  }
+
+  //====================================================
+  //     Events
+  //====================================================
+
+  // text
+  /**
+   * @brief Decodes UTF-8 text and writes its characters at the cursor. A character split between two chunks is completed by the next one.
+   *
+   */
+  OSMANIP_INLINE void Screen::text( std::string_view run )
+  {
+    cr_pending_ = false;
+    for( size_t i = 0; i < run.size(); )
+    {
+      const auto byte = static_cast<unsigned char>( run[ i ] );
+
+      // ASCII characters fitting before the right margin are written at once
+      if( byte < 0x80 && utf8_left_ == 0 && !wrap_pending_ )
+      {
+        size_t count = 1;
+        const size_t room = std::min( run.size() - i, width_ - col_ );
+        while( count < room && static_cast<unsigned char>( run[ i + count ] ) < 0x80 )
+        {
+          ++count;
+        }
+
+        put_ascii( run.data() + i, count );
+        i += count;
+        continue;
+      }
+      ++i;
+
+      if( utf8_left_ > 0 )
+      {
+        if( ( byte & 0xC0 ) == 0x80 )
+        {
+          utf8_ch_ = ( utf8_ch_ << 6 ) | ( byte & 0x3F );
+          if( --utf8_left_ == 0 )
+          {
+            put( utf8_ch_ );
+          }
+          continue;
+        }
+
+        // Truncated sequence
+        utf8_left_ = 0;
+        put( U'\uFFFD' );
+      }
+
+      if( byte < 0x80 )
+      {
+        put( byte );
+      }
+      else if( ( byte & 0xE0 ) == 0xC0 )
+      {
+        utf8_ch_ = byte & 0x1F;
+        utf8_left_ = 1;
+      }
+      else if( ( byte & 0xF0 ) == 0xE0 )
+      {
+        utf8_ch_ = byte & 0x0F;
+        utf8_left_ = 2;
+      }
+      else if( ( byte & 0xF8 ) == 0xF0 )
+      {
+        utf8_ch_ = byte & 0x07;
+        utf8_left_ = 3;
+      }
+      else
+      {
+        put( U'\uFFFD' );
+      }
+    }
+  }
+
+  // control
+  /**
+   * @brief Executes a control character. Tabs, carriage returns before a new line and characters without effect on the screen are also kept in the line, see Screen.
+   *
+   */
+  OSMANIP_INLINE void Screen::control( char code )
+  {
+    const bool after_cr = std::exchange( cr_pending_, false );
+    switch( code )
+    {
+      case '\n':
+      case '\v':
+      case '\f':
+      {
+        if( code == '\n' && after_cr && !lines_[ row_ ].crlf )
+        {
+          mark_changed( row_, row_ + 1 );
+          lines_[ row_ ].crlf = true;
+        }
+        col_ = 0;
+        line_feed();
+        break;
+      }
+      case '\r':
+      {
+        // Only a carriage return right after the text of the line can end it
+        const size_t written = lines_[ row_ ].cells.size();
+        cr_pending_ = ( wrap_pending_ ? col_ + 1 : col_ ) == written;
+        col_ = 0;
+        wrap_pending_ = false;
+        break;
+      }
+      case '\b':
+      {
+        if( wrap_pending_ )
+        {
+          wrap_pending_ = false;
+        }
+        else if( col_ > 0 )
+        {
+          --col_;
+        }
+        break;
+      }
+      case '\t':
+      {
+        // The tab is kept in a blank cell if the cells it skips are blank too
+        const size_t stop = std::min( ( col_ / 8 + 1 ) * 8, width_ - 1 );
+        std::vector<Cell> & cells = lines_[ row_ ].cells;
+        const auto skipped = [ & ]( size_t col ) { return col >= cells.size() || ( cells[ col ].ch == 0 && ( col == col_ || cells[ col ].control == 0 ) ); };
+        bool kept = stop > col_;
+        for( size_t col = col_; kept && col < stop; ++col )
+        {
+          kept = skipped( col );
+        }
+        if( kept )
+        {
+          mark_changed( row_, row_ + 1 );
+          if( col_ >= cells.size() )
+          {
+            cells.resize( col_ + 1 );
+          }
+          cells[ col_ ].ch = U'\t';
+          cells[ col_ ].style = style_;
+        }
+
+        col_ = stop;
+        wrap_pending_ = false;
+        break;
+      }
+      case '\0':
+      {
+        break;
+      }
+      default:
+      {
+        // Kept before the character written at the cursor
+        mark_changed( row_, row_ + 1 );
+        std::vector<Cell> & cells = lines_[ row_ ].cells;
+        if( col_ >= cells.size() )
+        {
+          cells.resize( col_ + 1 );
+        }
+        cells[ col_ ].control = static_cast<uint8_t>( code );
+      }
+    }
+  }
+
+  // csi
+  /**
+   * @brief Executes a CSI sequence. Sequences with a private marker or an intermediate byte, e.g. those hiding the cursor, don't change the screen and are ignored.
+   *
+   */
+  OSMANIP_INLINE void Screen::csi( const AnsiCsi & csi )
+  {
+    cr_pending_ = false;
+    if( csi.prefix != '\0' || csi.intermediate != '\0' )
+    {
+      return;
+    }
+
+    const size_t n = csi.param( 0, 1 );
+
+    switch( csi.final )
+    {
+      // Cursor movements, stopping at the margins of the scroll region if the cursor is inside it
+      case 'A':
+      {
+        const size_t limit = row_ >= top_ ? top_ : 0;
+        move_to( row_ >= limit + n ? row_ - n : limit, col_ );
+        break;
+      }
+      case 'B':
+      case 'e':
+      {
+        const size_t limit = row_ <= bottom_ ? bottom_ : height_ - 1;
+        move_to( std::min( row_ + n, limit ), col_ );
+        break;
+      }
+      case 'C':
+      case 'a':
+      {
+        move_to( row_, col_ + n );
+        break;
+      }
+      case 'D':
+      {
+        move_to( row_, col_ >= n ? col_ - n : 0 );
+        break;
+      }
+      case 'E':
+      {
+        const size_t limit = row_ <= bottom_ ? bottom_ : height_ - 1;
+        move_to( std::min( row_ + n, limit ), 0 );
+        break;
+      }
+      case 'F':
+      {
+        const size_t limit = row_ >= top_ ? top_ : 0;
+        move_to( row_ >= limit + n ? row_ - n : limit, 0 );
+        break;
+      }
+      case 'G':
+      case '`':
+      {
+        move_to( row_, n - 1 );
+        break;
+      }
+      case 'H':
+      case 'f':
+      {
+        move_to( n - 1, csi.param( 1, 1 ) - 1 );
+        break;
+      }
+      case 'd':
+      {
+        move_to( n - 1, col_ );
+        break;
+      }
+
+      // Erasures
+      case 'J':
+      {
+        erase_display( csi.param( 0 ) );
+        break;
+      }
+      case 'K':
+      {
+        const uint32_t mode = csi.param( 0 );
+        erase_line( row_, mode == 0 ? col_ : 0, mode == 1 ? col_ : width_ - 1 );
+        break;
+      }
+      case 'X':
+      {
+        erase_line( row_, col_, std::min( col_ + n, width_ ) - 1 );
+        break;
+      }
+
+      // Insertions and deletions
+      case 'L':
+      case 'M':
+      {
+        if( row_ >= top_ && row_ <= bottom_ )
+        {
+          if( csi.final == 'L' )
+          {
+            scroll_down( row_, bottom_, n );
+          }
+          else
+          {
+            scroll_up( row_, bottom_, n, false );
+          }
+          col_ = 0;
+          wrap_pending_ = false;
+        }
+        break;
+      }
+      case '@':
+      {
+        mark_changed( row_, row_ + 1 );
+        std::vector<Cell> & cells = lines_[ row_ ].cells;
+        if( col_ < cells.size() )
+        {
+          cells.insert( cells.begin() + col_, std::min( n, width_ - col_ ), Cell() );
+          if( cells.size() > width_ )
+          {
+            cells.resize( width_ );
+          }
+        }
+        wrap_pending_ = false;
+        break;
+      }
+      case 'P':
+      {
+        mark_changed( row_, row_ + 1 );
+        std::vector<Cell> & cells = lines_[ row_ ].cells;
+        if( col_ < cells.size() )
+        {
+          cells.erase( cells.begin() + col_, cells.begin() + std::min( col_ + n, cells.size() ) );
+        }
+        wrap_pending_ = false;
+        break;
+      }
+
+      // Scrolling
+      case 'S':
+      {
+        scroll_up( top_, bottom_, n, true );
+        break;
+      }
+      case 'T':
+      {
+        scroll_down( top_, bottom_, n );
+        break;
+      }
+      case 'r':
+      {
+        const size_t top = n - 1;
+        const size_t bottom = csi.param( 1 ) != 0 ? std::min<size_t>( csi.param( 1 ), height_ ) - 1 : height_ - 1;
+        if( top < bottom )
+        {
+          top_ = top;
+          bottom_ = bottom;
+          move_to( 0, 0 );
+        }
+        break;
+      }
+
+      // Cursor save and restore
+      case 's':
+      {
+        esc( '7', '\0' );
+        break;
+      }
+      case 'u':
+      {
+        esc( '8', '\0' );
+        break;
+      }
+      default:;
+    }
+  }
+
+  // sgr
+  /**
+   * @brief Sets the style of the following characters.
+   *
+   */
+  OSMANIP_INLINE void Screen::sgr( const Style & style )
+  {
+    style_ = style;
+  }
+
+  // esc
+  /**
+   * @brief Executes an escape sequence.
+   *
+   */
+  OSMANIP_INLINE void Screen::esc( char final, char intermediate )
+  {
+    cr_pending_ = false;
+    if( intermediate != '\0' )
+    {
+      return;
+    }
+
+    switch( final )
+    {
+      case '7':
+      {
+        saved_row_ = row_;
+        saved_col_ = col_;
+        saved_style_ = style_;
+        break;
+      }
+      case '8':
+      {
+        move_to( saved_row_, saved_col_ );
+        style_ = saved_style_;
+        break;
+      }
+      case 'D':
+      {
+        line_feed();
+        break;
+      }
+      case 'E':
+      {
+        col_ = 0;
+        line_feed();
+        break;
+      }
+      case 'M':
+      {
+        reverse_index();
+        break;
+      }
+      case 'c':
+      {
+        // Unlike reset(), the scrollback is kept as a terminal does
+        std::deque<ScreenLine> scrollback = std::move( scrollback_ );
+        reset();
+        scrollback_ = std::move( scrollback );
+        break;
+      }
+      default:;
+    }
+  }
+
+  //====================================================
+  //     Private methods
+  //====================================================
+
+  // put
+  /**
+   * @brief Writes a character at the cursor and moves the cursor right. A character written in the last column moves the cursor to the next line only when another character follows, as terminals do.
+   *
+   */
+  OSMANIP_INLINE void Screen::put( char32_t ch )
+  {
+    if( wrap_pending_ )
+    {
+      mark_changed( row_, row_ + 1 );
+      lines_[ row_ ].wrapped = true;
+      col_ = 0;
+      line_feed();
+    }
+
+    mark_changed( row_, row_ + 1 );
+    std::vector<Cell> & cells = lines_[ row_ ].cells;
+    if( col_ < cells.size() )
+    {
+      cells[ col_ ].ch = ch;
+      cells[ col_ ].style = style_;
+    }
+    else
+    {
+      if( col_ > cells.size() )
+      {
+        cells.resize( col_ );
+      }
+      cells.push_back( Cell { ch, style_ } );
+    }
+
+    if( col_ + 1 < width_ )
+    {
+      ++col_;
+    }
+    else
+    {
+      wrap_pending_ = true;
+    }
+  }
+
+  // put_ascii
+  /**
+   * @brief Writes ASCII characters at the cursor, looking up the line only once. They must fit before the right margin.
+   *
+   */
+  OSMANIP_INLINE void Screen::put_ascii( const char * chars, size_t count )
+  {
+    mark_changed( row_, row_ + 1 );
+    std::vector<Cell> & cells = lines_[ row_ ].cells;
+    if( col_ > cells.size() )
+    {
+      cells.resize( col_ );
+    }
+
+    const size_t overwritten = std::min( count, cells.size() - col_ );
+    for( size_t i = 0; i < overwritten; ++i )
+    {
+      cells[ col_ + i ].ch = static_cast<char32_t>( chars[ i ] );
+      cells[ col_ + i ].style = style_;
+    }
+    for( size_t i = overwritten; i < count; ++i )
+    {
+      cells.push_back( Cell { static_cast<char32_t>( chars[ i ] ), style_ } );
+    }
+
+    col_ += count;
+    if( col_ == width_ )
+    {
+      col_ = width_ - 1;
+      wrap_pending_ = true;
+    }
+  }
+
+  // move_to
+  /**
+   * @brief Moves the cursor, keeping it inside the screen.
+   *
+   */
+  OSMANIP_INLINE void Screen::move_to( size_t row, size_t col )
+  {
+    row_ = std::min( row, height_ - 1 );
+    col_ = std::min( col, width_ - 1 );
+    wrap_pending_ = false;
+  }
+
+  // line_feed
+  /**
+   * @brief Moves the cursor down, scrolling the scroll region if the cursor is on its bottom margin.
+   *
+   */
+  OSMANIP_INLINE void Screen::line_feed()
+  {
+    wrap_pending_ = false;
+
+    if( row_ == bottom_ )
+    {
+      scroll_up( top_, bottom_, 1, true );
+    }
+    else if( row_ + 1 < height_ )
+    {
+      ++row_;
+    }
+  }
+
+  // reverse_index
+  /**
+   * @brief Moves the cursor up, scrolling the scroll region down if the cursor is on its top margin.
+   *
+   */
+  OSMANIP_INLINE void Screen::reverse_index()
+  {
+    wrap_pending_ = false;
+
+    if( row_ == top_ )
+    {
+      scroll_down( top_, bottom_, 1 );
+    }
+    else if( row_ > 0 )
+    {
+      --row_;
+    }
+  }
+
+  // scroll_up
+  /**
+   * @brief Scrolls the lines between two rows up, adding blank lines at the bottom. When the whole screen scrolls, the lines are moved to the scrollback in O(1), and the storage of the lines dropped from the scrollback is reused.
+   *
+   * @param top the first row.
+   * @param bottom the last row.
+   * @param count the number of lines.
+   * @param to_scrollback false if the lines are deleted rather than scrolled off the screen.
+   *
+   */
+  OSMANIP_INLINE void Screen::scroll_up( size_t top, size_t bottom, size_t count, bool to_scrollback )
+  {
+    count = std::min( count, bottom - top + 1 );
+
+    if( top == 0 && bottom == height_ - 1 )
+    {
+      // The changed rows move up with the lines, unless lines are dropped
+      bool kept = to_scrollback && max_scrollback_ > 0;
+      for( size_t i = 0; i < count; ++i )
+      {
+        ScreenLine blank;
+        if( to_scrollback && max_scrollback_ > 0 )
+        {
+          if( scrollback_.size() >= max_scrollback_ )
+          {
+            blank = std::move( scrollback_.front() );
+            scrollback_.pop_front();
+            kept = false;
+          }
+          else if( !spare_.empty() )
+          {
+            blank = std::move( spare_.back() );
+            spare_.pop_back();
+          }
+          scrollback_.push_back( std::move( lines_.front() ) );
+        }
+        else
+        {
+          blank = std::move( lines_.front() );
+        }
+        lines_.pop_front();
+
+        blank.cells.clear();
+        blank.wrapped = false;
+        blank.crlf = false;
+        lines_.push_back( std::move( blank ) );
+      }
+
+      if( kept )
+      {
+        changed_.first -= std::min( changed_.first, count );
+        changed_.last -= std::min( changed_.last, count );
+        mark_changed( height_ - count, height_ );
+      }
+      else
+      {
+        mark_changed( 0, height_ );
+      }
+      return;
+    }
+
+    mark_changed( top, bottom + 1 );
+    const auto first = lines_.begin() + static_cast<ptrdiff_t>( top );
+    const auto last = lines_.begin() + static_cast<ptrdiff_t>( bottom + 1 );
+    std::rotate( first, first + static_cast<ptrdiff_t>( count ), last );
+    std::fill( last - static_cast<ptrdiff_t>( count ), last, ScreenLine() );
+  }
+
+  // scroll_down
+  /**
+   * @brief Scrolls the lines between two rows down, adding blank lines at the top.
+   *
+   * @param top the first row.
+   * @param bottom the last row.
+   * @param count the number of lines.
+   *
+   */
+  OSMANIP_INLINE void Screen::scroll_down( size_t top, size_t bottom, size_t count )
+  {
+    count = std::min( count, bottom - top + 1 );
+
+    mark_changed( top, bottom + 1 );
+    const auto first = lines_.begin() + static_cast<ptrdiff_t>( top );
+    const auto last = lines_.begin() + static_cast<ptrdiff_t>( bottom + 1 );
+    std::rotate( first, last - static_cast<ptrdiff_t>( count ), last );
+    std::fill( first, first + static_cast<ptrdiff_t>( count ), ScreenLine() );
+  }
+
+  // erase_line
+  /**
+   * @brief Erases the cells of a row between two columns, included. The cursor does not move.
+   *
+   */
+  OSMANIP_INLINE void Screen::erase_line( size_t row, size_t first, size_t last )
+  {
+    ScreenLine & line = lines_[ row ];
+    if( first >= line.cells.size() )
+    {
+      return;
+    }
+
+    mark_changed( row, row + 1 );
+    if( last + 1 >= line.cells.size() )
+    {
+      line.cells.resize( first );
+      line.wrapped = false;
+      line.crlf = false;
+    }
+    else
+    {
+      std::fill( line.cells.begin() + first, line.cells.begin() + last + 1, Cell() );
+    }
+  }
+
+  // erase_display
+  /**
+   * @brief Erases part of the screen: from the cursor to the end (mode 0), from the beginning to the cursor (mode 1), the whole screen (mode 2) or the whole screen and the scrollback (mode 3). The cursor does not move.
+   *
+   */
+  OSMANIP_INLINE void Screen::erase_display( uint32_t mode )
+  {
+    switch( mode )
+    {
+      case 0:
+      {
+        erase_line( row_, col_, width_ - 1 );
+        mark_changed( row_ + 1, height_ );
+        std::fill( lines_.begin() + static_cast<ptrdiff_t>( row_ + 1 ), lines_.end(), ScreenLine() );
+        break;
+      }
+      case 1:
+      {
+        mark_changed( 0, row_ );
+        std::fill( lines_.begin(), lines_.begin() + static_cast<ptrdiff_t>( row_ ), ScreenLine() );
+        erase_line( row_, 0, col_ );
+        break;
+      }
+      case 2:
+      case 3:
+      {
+        if( mode == 3 )
+        {
+          scrollback_.clear();
+        }
+        erase_all();
+        break;
+      }
+      default:;
+    }
+  }
+
+  // erase_all
+  /**
+   * @brief Erases the whole screen.
+   *
+   */
+  OSMANIP_INLINE void Screen::erase_all()
+  {
+    mark_changed( 0, height_ );
+    std::fill( lines_.begin(), lines_.end(), ScreenLine() );
+  }
+
+  // mark_changed
+  /**
+   * @brief Adds rows to the changed ones. The range is kept contiguous, which is exact for the usual output: new lines at the bottom and lines rewritten in place near them.
+   *
+   */
+  OSMANIP_INLINE void Screen::mark_changed( size_t first, size_t last )
+  {
+    if( first >= last )
+    {
+      return;
+    }
+    if( changed_.first >= changed_.last )
+    {
+      changed_ = RowRange { first, last };
+      return;
+    }
+    changed_.first = std::min( changed_.first, first );
+    changed_.last = std::max( changed_.last, last );
+  }
+
+}      // namespace osm
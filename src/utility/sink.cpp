@@ -0,0 +1,430 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file sink.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <pthread.h>
+#include <signal.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+// My headers
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/output_redirector.hpp>
+#include <osmanip/utility/sstream.hpp>
+
+// STD headers
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <errno.h>
+#include <limits.h>
+#include <stddef.h>
+#include <stdio.h>
+
+namespace osm
+{
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+#ifndef _WIN32
+    // SigpipeBlock
+    /**
+     * @brief Blocks SIGPIPE in the calling thread while it lives, so that writing to a pipe whose command has exited fails with EPIPE instead of ending the process. A SIGPIPE raised meanwhile is discarded, unless it was already pending.
+     *
+     */
+    class SigpipeBlock
+    {
+      public:
+      SigpipeBlock()
+      {
+        sigemptyset( &sigpipe_ );
+        sigaddset( &sigpipe_, SIGPIPE );
+        sigset_t pending;
+        sigpending( &pending );
+        was_pending_ = sigismember( &pending, SIGPIPE ) == 1;
+        pthread_sigmask( SIG_BLOCK, &sigpipe_, &previous_ );
+      }
+
+      ~SigpipeBlock()
+      {
+        const int error = errno;
+        sigset_t pending;
+        if( sigpending( &pending ) == 0 && sigismember( &pending, SIGPIPE ) == 1 && !was_pending_ )
+        {
+          int signal;
+          sigwait( &sigpipe_, &signal );
+        }
+        pthread_sigmask( SIG_SETMASK, &previous_, nullptr );
+        errno = error;
+      }
+
+      SigpipeBlock( const SigpipeBlock & ) = delete;
+      SigpipeBlock & operator=( const SigpipeBlock & ) = delete;
+
+      private:
+      sigset_t sigpipe_, previous_;
+      bool was_pending_;
+    };
+#endif
+  }      // namespace detail
+
+  //====================================================
+  //     Constructors
+  //====================================================
+
+  // FdSink
+  /**
+   * @brief Construct a new FdSink object. The file descriptor is not closed by the sink.
+   *
+   * @param fd the file descriptor.
+   * @param buffer_size the size of the buffer, 0 to write the output at once.
+   *
+   */
+  OSMANIP_INLINE FdSink::FdSink( int fd, size_t buffer_size ):
+   fd_( fd ),
+   buffer_size_( buffer_size )
+  {
+    buffer_.reserve( buffer_size );
+  }
+
+  // ~FdSink
+  /**
+   * @brief Destructs the FdSink object, writing the buffered output. Errors are ignored.
+   *
+   */
+  OSMANIP_INLINE FdSink::~FdSink()
+  {
+    try
+    {
+      flush();
+    }
+    catch( const std::runtime_error & )
+    {
+    }
+  }
+
+  // PipeSink
+  /**
+   * @brief Construct a new PipeSink object, starting the command.
+   *
+   * @param command the command, run by the shell.
+   *
+   * @throws std::runtime_error if the command cannot be started.
+   *
+   */
+  OSMANIP_INLINE PipeSink::PipeSink( const std::string & command )
+  {
+#ifdef _WIN32
+    pipe_ = _popen( command.c_str(), "wb" );
+#else
+    pipe_ = popen( command.c_str(), "w" );
+#endif
+    if( !pipe_ )
+    {
+      throw std::runtime_error( "Could not run the command '" + command + "'!" );
+    }
+  }
+
+  // ~PipeSink
+  /**
+   * @brief Destructs the PipeSink object, closing the pipe and waiting for the command to end.
+   *
+   */
+  OSMANIP_INLINE PipeSink::~PipeSink()
+  {
+    close();
+  }
+
+  // CallbackSink
+  /**
+   * @brief Construct a new CallbackSink object.
+   *
+   * @param on_write the function called with the output.
+   * @param on_flush the function called when the output is flushed, if any.
+   *
+   */
+  OSMANIP_INLINE CallbackSink::CallbackSink( std::function<void( std::string_view )> on_write, std::function<void()> on_flush ):
+   on_write_( std::move( on_write ) ),
+   on_flush_( std::move( on_flush ) )
+  {
+  }
+
+  // RedirectorSink
+  /**
+   * @brief Construct a new RedirectorSink object.
+   *
+   * @param redirector the redirector rendering the output, which must outlive the sink.
+   *
+   */
+  OSMANIP_INLINE RedirectorSink::RedirectorSink( OutputRedirector & redirector ):
+   redirector_( redirector )
+  {
+  }
+
+  //====================================================
+  //     Methods
+  //====================================================
+
+  // FdSink::write
+  /**
+   * @brief Adds output to the buffer. If it does not fit, the buffer and the output are written together.
+   *
+   * @throws std::runtime_error if the output cannot be written.
+   *
+   */
+  OSMANIP_INLINE void FdSink::write( std::string_view data )
+  {
+    if( buffer_.size() + data.size() <= buffer_size_ )
+    {
+      buffer_.append( data );
+      return;
+    }
+
+    write_all( buffer_, data );
+    buffer_.clear();
+  }
+
+  // FdSink::flush
+  /**
+   * @brief Writes the buffered output.
+   *
+   * @throws std::runtime_error if the output cannot be written.
+   *
+   */
+  OSMANIP_INLINE void FdSink::flush()
+  {
+    if( !buffer_.empty() )
+    {
+      write_all( buffer_, {} );
+      buffer_.clear();
+    }
+  }
+
+  // PipeSink::write
+  /**
+   * @brief Writes output to the command. On POSIX systems SIGPIPE is blocked meanwhile, so that a command which has exited makes the write fail instead of ending the process.
+   *
+   * @throws std::runtime_error if the pipe is closed or broken.
+   *
+   */
+  OSMANIP_INLINE void PipeSink::write( std::string_view data )
+  {
+    if( !pipe_ )
+    {
+      throw std::runtime_error( "Could not write to the pipe!" );
+    }
+
+#ifndef _WIN32
+    const detail::SigpipeBlock block;
+#endif
+    if( fwrite( data.data(), 1, data.size(), pipe_ ) != data.size() )
+    {
+      throw std::runtime_error( errno == EPIPE ? "The command of the pipe has exited!" : "Could not write to the pipe!" );
+    }
+  }
+
+  // PipeSink::flush
+  /**
+   * @brief Sends the output written so far to the command. SIGPIPE is handled as in write.
+   *
+   * @throws std::runtime_error if the pipe is broken.
+   *
+   */
+  OSMANIP_INLINE void PipeSink::flush()
+  {
+    if( !pipe_ )
+    {
+      return;
+    }
+
+#ifndef _WIN32
+    const detail::SigpipeBlock block;
+#endif
+    if( fflush( pipe_ ) != 0 )
+    {
+      throw std::runtime_error( errno == EPIPE ? "The command of the pipe has exited!" : "Could not write to the pipe!" );
+    }
+  }
+
+  // PipeSink::close
+  /**
+   * @brief Closes the pipe and waits for the command to end. Following writes throw.
+   *
+   * @return the exit status of the command as returned by pclose, -1 if the pipe was already closed.
+   *
+   */
+  OSMANIP_INLINE int PipeSink::close()
+  {
+    if( !pipe_ )
+    {
+      return -1;
+    }
+
+#ifdef _WIN32
+    const int status = _pclose( std::exchange( pipe_, nullptr ) );
+#else
+    const detail::SigpipeBlock block;
+    const int status = pclose( std::exchange( pipe_, nullptr ) );
+#endif
+    return status;
+  }
+
+  // CallbackSink::write
+  /**
+   * @brief Passes output to the write function.
+   *
+   */
+  OSMANIP_INLINE void CallbackSink::write( std::string_view data )
+  {
+    on_write_( data );
+  }
+
+  // CallbackSink::flush
+  /**
+   * @brief Calls the flush function, if any.
+   *
+   */
+  OSMANIP_INLINE void CallbackSink::flush()
+  {
+    if( on_flush_ )
+    {
+      on_flush_();
+    }
+  }
+
+  // RedirectorSink::write
+  /**
+   * @brief Adds output to the buffer of the redirector.
+   *
+   */
+  OSMANIP_INLINE void RedirectorSink::write( std::string_view data )
+  {
+    redirector_.write( data.data(), static_cast<std::streamsize>( data.size() ) );
+  }
+
+  // RedirectorSink::flush
+  /**
+   * @brief Renders the output to the file, or hands it over to the writer thread of an asynchronous redirector.
+   *
+   */
+  OSMANIP_INLINE void RedirectorSink::flush()
+  {
+    static_cast<std::ostream &>( redirector_ ).flush();
+  }
+
+  //====================================================
+  //     Private methods
+  //====================================================
+
+  // write_all
+  /**
+   * @brief Writes two blocks of output, retrying after partial writes and interruptions.
+   *
+   * @throws std::runtime_error if the output cannot be written.
+   *
+   */
+  OSMANIP_INLINE void FdSink::write_all( std::string_view first, std::string_view second )
+  {
+#ifdef _WIN32
+    for( std::string_view data: { first, second } )
+    {
+      while( !data.empty() )
+      {
+        const int written = _write( fd_, data.data(), static_cast<unsigned>( std::min<size_t>( data.size(), INT_MAX ) ) );
+        if( written < 0 )
+        {
+          throw std::runtime_error( "Could not write to the file descriptor!" );
+        }
+        data.remove_prefix( static_cast<size_t>( written ) );
+      }
+    }
+#else
+    iovec parts[ 2 ] = { { const_cast<char *>( first.data() ), first.size() }, { const_cast<char *>( second.data() ), second.size() } };
+    size_t part = 0;
+    while( part < 2 )
+    {
+      if( parts[ part ].iov_len == 0 )
+      {
+        ++part;
+        continue;
+      }
+
+      const ssize_t written = ::writev( fd_, parts + part, static_cast<int>( 2 - part ) );
+      if( written < 0 )
+      {
+        if( errno == EINTR )
+        {
+          continue;
+        }
+        throw std::runtime_error( "Could not write to the file descriptor!" );
+      }
+
+      for( auto left = static_cast<size_t>( written ); left > 0; )
+      {
+        const size_t step = std::min( left, parts[ part ].iov_len );
+        parts[ part ].iov_base = static_cast<char *>( parts[ part ].iov_base ) + step;
+        parts[ part ].iov_len -= step;
+        left -= step;
+        if( parts[ part ].iov_len == 0 )
+        {
+          ++part;
+        }
+      }
+    }
+#endif
+  }
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // setSink
+  /**
+   * @brief Sends the output of osm::cout, and so of every renderer of the library, to a sink instead of its stream, e.g. std::cout. Output redirection, when enabled, still takes precedence; in tee mode the raw output goes to the sink.
+   *
+   * @param sink the sink, which must outlive its use, or nullptr to go back to the stream.
+   *
+   */
+  OSMANIP_INLINE void setSink( Sink * sink )
+  {
+    cout.flush();
+    static_cast<Ostreambuf *>( cout.rdbuf() )->setSink( sink );
+  }
+
+  // getSink
+  /**
+   * @brief Returns the sink of osm::cout.
+   *
+   * @return the sink, nullptr if the output goes to the stream of osm::cout.
+   *
+   */
+  OSMANIP_INLINE Sink * getSink()
+  {
+    return static_cast<Ostreambuf *>( cout.rdbuf() )->getSink();
+  }
+
+}      // namespace osm
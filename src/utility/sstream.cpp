@@ -16,9 +16,12 @@
 #include <osmanip/utility/sstream.hpp>
 #include <osmanip/utility/iostream.hpp>
 #include <osmanip/utility/output_redirector.hpp>
+#include <osmanip/utility/sink.hpp>
 
 // STD headers
+#include <exception>
 #include <memory>
+#include <string_view>
 
 namespace osm
 {
@@ -32,14 +35,14 @@ namespace osm
    * @brief Construct a new Stringbuf object. Default constructor will set the main attributes to default values.
    *
    */
-  Stringbuf::Stringbuf() = default;
+  OSMANIP_INLINE Stringbuf::Stringbuf() = default;
 
   // Destructor
   /**
    * @brief Destructs OutputRedirector object. Calls this->pubsync() before being destroyed.
    *
    */
-  Stringbuf::~Stringbuf()
+  OSMANIP_INLINE Stringbuf::~Stringbuf()
   {
     // Flush before destroying
     this->pubsync();
@@ -56,7 +59,7 @@ namespace osm
    * @return the mutex of the object.
    *
    */
-  std::mutex & Stringbuf::getMutex()
+  OSMANIP_INLINE std::mutex & Stringbuf::getMutex()
   {
     return mutex_;
   }
@@ -72,7 +75,7 @@ namespace osm
    * @return the error state of the underlying buffer.
    *
    */
-  int32_t Stringbuf::sync()
+  OSMANIP_INLINE int32_t Stringbuf::sync()
   {
     return basic_streambuf::sync();
   }
@@ -87,8 +90,9 @@ namespace osm
    * @brief Construct a new Ostreambuf object. Default constructor will set the main attributes to default values.
    *
    */
-  Ostreambuf::Ostreambuf():
-   ostream_( nullptr )
+  OSMANIP_INLINE Ostreambuf::Ostreambuf():
+   ostream_( nullptr ),
+   sink_( nullptr )
   {
   }
 
@@ -99,8 +103,9 @@ namespace osm
    * @param out the std::ostream object to use to output the buffer data.
    *
    */
-  Ostreambuf::Ostreambuf( std::ostream * out ):
-   ostream_( out )
+  OSMANIP_INLINE Ostreambuf::Ostreambuf( std::ostream * out ):
+   ostream_( out ),
+   sink_( nullptr )
   {
   }
 
@@ -109,12 +114,13 @@ namespace osm
    * @brief Destructs OutputRedirector object. Calls this->pubsync() before being destroyed.
    *
    */
-  Ostreambuf::~Ostreambuf()
+  OSMANIP_INLINE Ostreambuf::~Ostreambuf()
   {
     // Flush before destroying
     this->pubsync();
 
     ostream_ = nullptr;
+    sink_ = nullptr;
   }
 
   //====================================================
@@ -126,7 +132,7 @@ namespace osm
    * @brief Sets the std::ostream* object to route output. If there is already an std::ostream* present, it will be flushed before it is replaced.
    *
    */
-  void Ostreambuf::setOstream( std::ostream * out )
+  OSMANIP_INLINE void Ostreambuf::setOstream( std::ostream * out )
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
     if( ostream_ )
@@ -137,6 +143,24 @@ namespace osm
     ostream_ = out;
   }
 
+  // setSink
+  /**
+   * @brief Sets the Sink object to route output instead of the std::ostream* object. If there is already a Sink present, it will be flushed before it is replaced. The buffer is not synchronized, see osm::setSink.
+   *
+   * @param sink the Sink object, or nullptr to route output to the std::ostream* object again.
+   *
+   */
+  OSMANIP_INLINE void Ostreambuf::setSink( Sink * sink )
+  {
+    std::scoped_lock<std::mutex> slock { this->getMutex() };
+    if( sink_ )
+    {
+      sink_->flush();
+    }
+
+    sink_ = sink;
+  }
+
   //====================================================
   //     Getters
   //====================================================
@@ -148,29 +172,46 @@ namespace osm
    * @return if present, the std::ostream* object. Otherwise, nullptr.
    *
    */
-  std::ostream * Ostreambuf::getOstream()
+  OSMANIP_INLINE std::ostream * Ostreambuf::getOstream()
   {
     std::scoped_lock<std::mutex> slock { this->getMutex() };
     return ostream_;
   }
 
+  // getSink
+  /**
+   * @brief Returns the current Sink object.
+   *
+   * @return if present, the Sink object. Otherwise, nullptr.
+   *
+   */
+  OSMANIP_INLINE Sink * Ostreambuf::getSink()
+  {
+    std::scoped_lock<std::mutex> slock { this->getMutex() };
+    return sink_;
+  }
+
   //====================================================
   //     Virtual methods
   //====================================================
 
   // sync
   /**
-   * @brief Synchronizes the buffer with the specified object.
+   * @brief Synchronizes the buffer with the specified object: the output redirection object if enabled, else the Sink object if present, else the std::ostream object.
    *
    * @return the error state of the stream buffer.
    *
    */
-  int32_t Ostreambuf::sync()
+  OSMANIP_INLINE int32_t Ostreambuf::sync()
   {
     if( redirout.isEnabled() )
     {
       sync_redirection();
-      return redirout.rdstate();
+      return redirout.get().rdstate();
+    }
+    else if( sink_ )
+    {
+      return sync_sink();
     }
     else if( ostream_ )
     {
@@ -187,25 +228,76 @@ namespace osm
 
   // sync_output
   /**
-   * @brief Synchronizes the buffer with the specified std::ostream object and calls flush() on the object.
+   * @brief Synchronizes the buffer with the specified std::ostream object and calls flush() on the object. An empty buffer is not inserted, since that would set the failbit of the object.
    *
    */
-  void Ostreambuf::sync_output()
+  OSMANIP_INLINE void Ostreambuf::sync_output()
   {
     std::scoped_lock<std::mutex> buf_lock( this->getMutex() );
-    *ostream_ << this << std::flush;
+    if( this->in_avail() > 0 )
+    {
+      *ostream_ << this;
+    }
+    ostream_->flush();
+    this->str( "" );
+  }
+
+  // sync_sink
+  /**
+   * @brief Passes the buffer to the Sink object without copying it and calls flush() on the object. Exceptions thrown by the Sink object are reported as a failure, as for a std::ostream object, and the buffer is discarded. If the Sink object was removed meanwhile, the buffer is synchronized again with the current target.
+   *
+   * @return 0 on success, -1 on failure.
+   *
+   */
+  OSMANIP_INLINE int32_t Ostreambuf::sync_sink()
+  {
+    std::unique_lock<std::mutex> buf_lock( this->getMutex() );
+    if( !sink_ )
+    {
+      buf_lock.unlock();
+      return sync();
+    }
+
+    int32_t status = 0;
+    try
+    {
+      if( this->pptr() > this->pbase() )
+      {
+        sink_->write( std::string_view( this->pbase(), static_cast<size_t>( this->pptr() - this->pbase() ) ) );
+      }
+      sink_->flush();
+    }
+    catch( const std::exception & )
+    {
+      status = -1;
+    }
     this->str( "" );
+    return status;
   }
 
   // sync_redirection
   /**
-   * @brief Synchronizes the buffer with the output redirection object and calls flush() on the object.
+   * @brief Synchronizes the buffer with the output redirection object and calls flush() on the object. An empty buffer is not inserted, since that would set the failbit of the object. The flush of std::ostream is called, which does not wait for the writer thread of an asynchronous redirector. In tee mode, the buffer is first written unchanged to the Sink object if present, else to the std::ostream object.
    *
    */
-  void Ostreambuf::sync_redirection()
+  OSMANIP_INLINE void Ostreambuf::sync_redirection()
   {
     std::scoped_lock<std::mutex> buf_lock( this->getMutex() );
-    redirout << this << std::flush;
+    if( this->in_avail() > 0 )
+    {
+      if( sink_ && redirout.isTee() )
+      {
+        sink_->write( std::string_view( this->pbase(), static_cast<size_t>( this->pptr() - this->pbase() ) ) );
+        sink_->flush();
+      }
+      else if( ostream_ && redirout.isTee() )
+      {
+        ostream_->write( this->pbase(), this->pptr() - this->pbase() );
+        ostream_->flush();
+      }
+      redirout.get() << this;
+    }
+    static_cast<std::ostream &>( redirout.get() ).flush();
     this->str( "" );
   }
 }      // namespace osm
\ No newline at end of file
@@ -14,16 +14,88 @@
 
 // My headers
 #include <osmanip/utility/strings.hpp>
+#include <osmanip/utility/ansi_parser.hpp>
 #include <osmanip/utility/iostream.hpp>
 
 // STD headers
 #include <stdexcept>
 #include <stdio.h>
 #include <cctype>
+#include <string_view>
 
 namespace osm
 {
 
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    OSMANIP_STATIC void apply_csi( char code, int32_t number, std::string & dst_str, int32_t * dst_crsr_pos );
+
+    // FormattingHandler
+    /**
+     * @brief Receives the events of the parser used by get_formatted_from_ansi, and writes the text into the formatted string at the cursor position.
+     *
+     */
+    struct FormattingHandler: public AnsiHandler
+    {
+      std::string & res;
+      int32_t & dst_crsr_pos;
+
+      FormattingHandler( std::string & res, int32_t & dst_crsr_pos ):
+       res( res ),
+       dst_crsr_pos( dst_crsr_pos )
+      {
+      }
+
+      void text( std::string_view run ) override
+      {
+        if( dst_crsr_pos > ( int32_t )res.size() )
+        {
+          dst_crsr_pos = ( int32_t )res.size();
+        }
+
+        // Overwrite the characters of the current line, then insert or append the rest of the run at once
+        size_t i = 0;
+        for( ; i < run.size() && dst_crsr_pos < ( int32_t )res.size() && res[ dst_crsr_pos ] != '\n'; ++i )
+        {
+          res[ dst_crsr_pos++ ] = run[ i ];
+        }
+
+        if( i < run.size() )
+        {
+          res.insert( ( size_t )dst_crsr_pos, run.data() + i, run.size() - i );
+          dst_crsr_pos += ( int32_t )( run.size() - i );
+        }
+      }
+
+      void control( char code ) override
+      {
+        if( code == '\n' )
+        {
+          res += code;
+          dst_crsr_pos = ( int32_t )res.size();
+        }
+        else
+        {
+          text( std::string_view( &code, 1 ) );
+        }
+      }
+
+      void csi( const AnsiCsi & csi ) override
+      {
+        if( csi.prefix == '\0' && csi.intermediate == '\0' )
+        {
+          // Cursor movements default to 1 cell, erasures to mode 0
+          const uint32_t def = ( csi.final == 'J' || csi.final == 'K' ) ? 0 : 1;
+          apply_csi( csi.final, ( int32_t )csi.param( 0, def ), res, &dst_crsr_pos );
+        }
+      }
+    };
+  }      // namespace detail
+
   //====================================================
   //     Functions
   //====================================================
@@ -36,7 +108,7 @@ namespace osm
    * @return string with no leading or tailing spaces.
    *
    */
-  std::string trim_string( const std::string & str )
+  OSMANIP_INLINE std::string trim_string( const std::string & str )
   {
     if( str.empty() )
     {
@@ -71,7 +143,7 @@ namespace osm
    * @return the index of the alpha char if successful, otherwise std::string::npos.
    *
    */
-  [[maybe_unused]] size_t find_first_alpha( const std::string & str, size_t pos )
+  [[maybe_unused]] OSMANIP_INLINE size_t find_first_alpha( const std::string & str, size_t pos )
   {
     for( size_t i = pos; i < str.size(); ++i )
     {
@@ -94,7 +166,7 @@ namespace osm
    * @return a correctly formatted string, free of any ANSI escape sequences.
    *
    */
-  std::string get_formatted_from_ansi( const std::string & str, int32_t * last_pos, int32_t * last_size )
+  OSMANIP_INLINE std::string get_formatted_from_ansi( const std::string & str, int32_t * last_pos, int32_t * last_size )
   {
     int32_t dst_crsr_pos = last_pos ? *last_pos : 0;
     int32_t last_dst_str_len = last_size ? *last_size : 0;
@@ -103,71 +175,16 @@ namespace osm
     std::string res;
     res.reserve( str.size() );
 
-    std::string ch;
-    ch.reserve( 1 );
-
     // Get the most recently formatted string (if available)
     if( last_dst_str_len > 0 && ( int32_t )str.size() >= last_dst_str_len )
     {
-      res = str.substr( 0, last_dst_str_len );
+      res.assign( str, 0, last_dst_str_len );
       src_crsr_pos = last_dst_str_len;
     }
 
-    for( ; src_crsr_pos < ( int32_t )str.size(); ++src_crsr_pos )
-    {
-      ch = str.at( src_crsr_pos );
-
-      if( ch.front() == '\033' )
-      {
-        // Extract the ansi escape sequence from str and move past it
-        std::string csi_str = get_ansi_csi_string( str, src_crsr_pos );
-
-        // Not a complete CSI
-        if( csi_str.empty() )
-        {
-          if( src_crsr_pos + 1 < ( int32_t )str.size() && str.at( src_crsr_pos + 1 ) == '[' )
-          {
-            // Move past the bracket
-            src_crsr_pos += 2;
-          }
-          else
-          {
-            // Move past the ESC
-            src_crsr_pos += 1;
-          }
-        }
-        else
-        {
-          // Move past the CSI and handle it in the res string
-          src_crsr_pos += ( int32_t )csi_str.size();
-          handle_csi( csi_str, res, &dst_crsr_pos );
-        }
-
-        --src_crsr_pos;
-      }
-      else
-      {
-        if( ch.front() == '\n' || dst_crsr_pos >= ( int32_t )res.size() )
-        {
-          res += ch;
-          dst_crsr_pos = ( int32_t )res.size();
-        }
-        else
-        {
-          // We don't want to overwrite the new line, so we insert it instead of replacing it
-          if( res.at( dst_crsr_pos ) == '\n' )
-          {
-            res.insert( dst_crsr_pos, ch );
-          }
-          else
-          {
-            res.replace( dst_crsr_pos, 1, ch );
-          }
-
-          ++dst_crsr_pos;
-        }
-      }
-    }
+    detail::FormattingHandler handler( res, dst_crsr_pos );
+    AnsiParser parser;
+    parser.feed( std::string_view( str ).substr( src_crsr_pos ), handler );
 
     if( last_pos )
     {
@@ -195,7 +212,7 @@ namespace osm
    * @return a string of the ANSI CSI if found, otherwise an empty string.
    *
    */
-  [[maybe_unused]] std::string get_ansi_csi_string( const std::string & str, size_t esc_pos )
+  [[maybe_unused]] OSMANIP_INLINE std::string get_ansi_csi_string( const std::string & str, size_t esc_pos )
   {
     if( str.at( esc_pos ) != '\033' )
     {
@@ -218,7 +235,7 @@ namespace osm
    * @return the number of the ANSI CSI if found.
    *
    */
-  [[maybe_unused]] int32_t get_ansi_csi_number( const std::string & csi )
+  [[maybe_unused]] OSMANIP_INLINE int32_t get_ansi_csi_number( const std::string & csi )
   {
     const size_t n_pos = 2;
 
@@ -262,7 +279,7 @@ namespace osm
    * @return the code of the ANSI CSI if found. Otherwise, returns a null terminator.
    *
    */
-  [[maybe_unused]] char get_ansi_csi_code( const std::string & csi )
+  [[maybe_unused]] OSMANIP_INLINE char get_ansi_csi_code( const std::string & csi )
   {
     const size_t n_pos = 2;
 
@@ -295,7 +312,7 @@ namespace osm
    * @param dst_crsr_pos the current position (index) of the destination string
    *
    */
-  [[maybe_unused]] void handle_csi( const std::string & csi_str, std::string & dst_str, int32_t * dst_crsr_pos )
+  [[maybe_unused]] OSMANIP_INLINE void handle_csi( const std::string & csi_str, std::string & dst_str, int32_t * dst_crsr_pos )
   {
     int32_t number;
     try
@@ -308,8 +325,21 @@ namespace osm
       return;
     }
 
-    char code = get_ansi_csi_code( csi_str );
+    detail::apply_csi( get_ansi_csi_code( csi_str ), number, dst_str, dst_crsr_pos );
+  }
 
+  // apply_csi
+  /**
+   * @brief Executes the command of an ANSI CSI on the destination string, see handle_csi.
+   *
+   * @param code the command code of the CSI.
+   * @param number the number (n) of the CSI.
+   * @param dst_str the destination string to modify
+   * @param dst_crsr_pos the current position (index) of the destination string
+   *
+   */
+  OSMANIP_INLINE void detail::apply_csi( char code, int32_t number, std::string & dst_str, int32_t * dst_crsr_pos )
+  {
     int32_t curr_pos = *dst_crsr_pos < ( int32_t )dst_str.size() ? *dst_crsr_pos : ( int32_t )dst_str.size();
     int32_t starting_pos = 0;
     int32_t line_len = 0;
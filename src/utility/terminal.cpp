@@ -0,0 +1,245 @@
+//====================================================
+//     File data
+//====================================================
+/**
+ * @file terminal.cpp
+ * @author Joel Thomas (joelthomas.e@gmail.com)
+ * @date 2026-10-19
+ * @copyright Copyright (c) 2022 Gianluca Bianco under the MIT license.
+ */
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// My headers
+#include <osmanip/utility/terminal.hpp>
+#include <osmanip/utility/iostream.hpp>
+
+// STD headers
+#include <atomic>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace osm
+{
+
+  //====================================================
+  //     Variables
+  //====================================================
+
+  namespace detail
+  {
+    OSMANIP_STATIC std::atomic<ESCAPES> escapes_mode { ESCAPES::AUTO };
+  }      // namespace detail
+
+  //====================================================
+  //     Helpers
+  //====================================================
+
+  namespace detail
+  {
+    // get_env
+    /**
+     * @brief Returns the value of an environment variable, or an empty string if it is not set.
+     *
+     */
+    OSMANIP_STATIC std::string get_env( const char * name )
+    {
+      const char * value = std::getenv( name );
+      return value ? value : "";
+    }
+
+    // contains_nocase
+    /**
+     * @brief Case-insensitive substring search.
+     *
+     */
+    OSMANIP_STATIC bool contains_nocase( const std::string & str, const std::string & sub )
+    {
+      if( sub.size() > str.size() )
+      {
+        return false;
+      }
+
+      for( size_t i = 0; i + sub.size() <= str.size(); ++i )
+      {
+        size_t j = 0;
+        while( j < sub.size() && std::tolower( static_cast<unsigned char>( str[ i + j ] ) ) == sub[ j ] )
+        {
+          ++j;
+        }
+
+        if( j == sub.size() )
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+  }      // namespace detail
+
+  //====================================================
+  //     Functions
+  //====================================================
+
+  // probe_terminal
+  /**
+   * @brief Inspects the standard output and the environment (TERM, COLORTERM, NO_COLOR, CLICOLOR_FORCE, FORCE_COLOR and the locale variables) to find out the terminal capabilities. The result is not cached, see terminal().
+   *
+   * @return the capabilities of the terminal.
+   *
+   */
+  OSMANIP_INLINE TerminalInfo probe_terminal()
+  {
+    TerminalInfo info {};
+
+    info.term = detail::get_env( "TERM" );
+    info.colorterm = detail::get_env( "COLORTERM" );
+
+#ifdef _WIN32
+    info.is_tty = _isatty( _fileno( stdout ) );
+#else
+    info.is_tty = isatty( STDOUT_FILENO );
+#endif
+
+    // Conventional variables used to force escape sequences into pipes
+    const std::string clicolor_force = detail::get_env( "CLICOLOR_FORCE" );
+    if( ( !clicolor_force.empty() && clicolor_force != "0" ) || std::getenv( "FORCE_COLOR" ) )
+    {
+      info.is_tty = true;
+    }
+
+    info.ansi = info.is_tty && info.term != "dumb";
+    info.color = info.ansi && detail::get_env( "NO_COLOR" ).empty();
+
+    // Color depth
+    if( detail::contains_nocase( info.colorterm, "truecolor" ) || detail::contains_nocase( info.colorterm, "24bit" ) || detail::contains_nocase( info.term, "direct" ) )
+    {
+      info.color_depth = COLORDEPTH::TRUECOLOR;
+    }
+    else if( detail::contains_nocase( info.term, "256color" ) )
+    {
+      info.color_depth = COLORDEPTH::C256;
+    }
+    else
+    {
+#ifdef _WIN32
+      // Windows 10 consoles with virtual terminal processing support 24-bit colors
+      info.color_depth = info.term.empty() ? COLORDEPTH::TRUECOLOR : COLORDEPTH::C16;
+#else
+      info.color_depth = COLORDEPTH::C16;
+#endif
+    }
+
+    // Unicode
+#ifdef _WIN32
+    info.unicode = GetConsoleOutputCP() == CP_UTF8;
+#else
+    std::string locale = detail::get_env( "LC_ALL" );
+    if( locale.empty() ) locale = detail::get_env( "LC_CTYPE" );
+    if( locale.empty() ) locale = detail::get_env( "LANG" );
+    info.unicode = detail::contains_nocase( locale, "utf-8" ) || detail::contains_nocase( locale, "utf8" );
+#endif
+
+    return info;
+  }
+
+  // terminal
+  /**
+   * @brief Returns the capabilities of the terminal. They are probed once, on the first call, and then cached.
+   *
+   * @return the cached capabilities of the terminal.
+   *
+   */
+  OSMANIP_INLINE const TerminalInfo & terminal()
+  {
+    static const TerminalInfo info = probe_terminal();
+    return info;
+  }
+
+  // setEscapes
+  /**
+   * @brief Sets whether escape sequences are emitted. AUTO (default) relies on the terminal capabilities, ON and OFF override them.
+   *
+   * @param mode the new mode.
+   *
+   */
+  OSMANIP_INLINE void setEscapes( ESCAPES mode )
+  {
+    detail::escapes_mode.store( mode, std::memory_order_relaxed );
+  }
+
+  // getEscapes
+  /**
+   * @brief Returns the current escape sequences mode.
+   *
+   * @return the current mode.
+   *
+   */
+  OSMANIP_INLINE ESCAPES getEscapes()
+  {
+    return detail::escapes_mode.load( std::memory_order_relaxed );
+  }
+
+#ifndef OSMANIP_DISABLE_OUTPUT
+
+  // escapes_enabled
+  /**
+   * @brief Returns whether cursor and control sequences must be emitted. In AUTO mode they are also enabled during output redirection, which needs them to render the output.
+   *
+   * @return true if the sequences must be emitted. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool escapes_enabled()
+  {
+    switch( detail::escapes_mode.load( std::memory_order_relaxed ) )
+    {
+      case ESCAPES::ON: return true;
+      case ESCAPES::OFF: return false;
+      default: return terminal().ansi || redirout.isEnabled();
+    }
+  }
+
+  // colors_enabled
+  /**
+   * @brief Returns whether color and style (SGR) sequences must be emitted.
+   *
+   * @return true if the sequences must be emitted. Otherwise, returns false.
+   *
+   */
+  OSMANIP_INLINE bool colors_enabled()
+  {
+    switch( detail::escapes_mode.load( std::memory_order_relaxed ) )
+    {
+      case ESCAPES::ON: return true;
+      case ESCAPES::OFF: return false;
+      default: return terminal().color;
+    }
+  }
+
+  // color_depth
+  /**
+   * @brief Returns the palette in which colors must be encoded, or COLORDEPTH::NONE if colors are disabled.
+   *
+   * @return the color depth.
+   *
+   */
+  OSMANIP_INLINE COLORDEPTH color_depth()
+  {
+    return colors_enabled() ? terminal().color_depth : COLORDEPTH::NONE;
+  }
+
+#endif
+
+}      // namespace osm
@@ -44,10 +44,13 @@ namespace osm
   //     Variables
   //====================================================
   #ifdef _WIN32
-  static HANDLE stdoutHandle;
-  static DWORD outModeInit;
+  namespace detail
+  {
+    OSMANIP_STATIC HANDLE stdoutHandle;
+    OSMANIP_STATIC DWORD outModeInit;
+  }      // namespace detail
   #endif
-  std::string old_chcp;
+  OSMANIP_INLINE std::string old_chcp;
   
   //====================================================
   //     Functions
@@ -58,30 +61,30 @@ namespace osm
    * @brief Function used to enable ANSI escape sequences on Windows. 
    * 
    */
-  void enableANSI()
+  OSMANIP_INLINE void enableANSI()
    {
     // Settings for Windows mode
     #ifdef _WIN32
 
     DWORD outMode = 0;
-    stdoutHandle = GetStdHandle( STD_OUTPUT_HANDLE );
+    detail::stdoutHandle = GetStdHandle( STD_OUTPUT_HANDLE );
     
-    if( stdoutHandle == INVALID_HANDLE_VALUE )
+    if( detail::stdoutHandle == INVALID_HANDLE_VALUE )
      {
       exit( GetLastError() );
      }
     
-    if( ! GetConsoleMode( stdoutHandle, &outMode ) )
+    if( ! GetConsoleMode( detail::stdoutHandle, &outMode ) )
      {
       exit( GetLastError() );
      }
     
-    outModeInit = outMode;
+    detail::outModeInit = outMode;
     
     // Enable ANSI escape codes
     outMode |= ENABLE_VIRTUAL_TERMINAL_PROCESSING;
     
-    if( ! SetConsoleMode( stdoutHandle, outMode ) )
+    if( ! SetConsoleMode( detail::stdoutHandle, outMode ) )
      {
       exit( GetLastError() );
      }
@@ -90,7 +93,7 @@ namespace osm
    }
   
   // disableANSI
-  void disableANSI()
+  OSMANIP_INLINE void disableANSI()
   /**
    * @brief Function used to disable ANSI escape sequences on Windows.
    * 
@@ -103,7 +106,7 @@ namespace osm
     #ifdef _WIN32
   
     // Reset console mode
-    if( ! SetConsoleMode( stdoutHandle, outModeInit ) )
+    if( ! SetConsoleMode( detail::stdoutHandle, detail::outModeInit ) )
      {
       exit( GetLastError() );
      }
@@ -116,7 +119,7 @@ namespace osm
    * @brief Function used to enable UNICODE characters (used for Windows only).
    * 
    */
-  void enableUNICODE()
+  OSMANIP_INLINE void enableUNICODE()
    {
     // Settings for Windows mode
     #ifdef _WIN32
@@ -134,7 +137,7 @@ namespace osm
    * @brief Function used to disable UNICODE characters (used for Windows only).
    * 
    */
-  void disableUNICODE()
+  OSMANIP_INLINE void disableUNICODE()
    {
     // Settings for Windows mode
     #ifdef _WIN32
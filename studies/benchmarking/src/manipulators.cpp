@@ -6,6 +6,11 @@
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/manipulators/cursor.hpp>
 #include <osmanip/manipulators/decorator.hpp>
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/gradient.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/printer.hpp>
 
 // Headers for comparison
 #include <termcolor/termcolor.hpp>
@@ -39,6 +44,20 @@ static void osmanip_colsty_RGB( bm::State& state )
   for ( auto _ : state ) bm::DoNotOptimize( std::cout << osm::RGB( 2, 4, 6 ) );
  }
 
+// osmanip_colsty_rgb_fg
+static void osmanip_colsty_rgb_fg( bm::State& state ) 
+ {
+  char buffer[ osm::SGR_COLOR_MAX_SIZE ];
+  for ( auto _ : state ) bm::DoNotOptimize( osm::rgb_fg( buffer, 2, 4, 6 ) );
+ }
+
+// osmanip_colsty_rgb_fg_256
+static void osmanip_colsty_rgb_fg_256( bm::State& state ) 
+ {
+  char buffer[ osm::SGR_COLOR_MAX_SIZE ];
+  for ( auto _ : state ) bm::DoNotOptimize( osm::rgb_fg( buffer, 2, 4, 6, osm::COLORDEPTH::C256 ) );
+ }
+
 // osmanip_cursor_feat
 static void osmanip_cursor_feat( bm::State& state ) 
  {
@@ -51,8 +70,88 @@ static void osmanip_cursor_go_to( bm::State& state )
   for ( auto _ : state ) bm::DoNotOptimize( osm::go_to( 0, 0 ) );
  }
 
+// osmanip_cursor_up
+static void osmanip_cursor_up( bm::State& state ) 
+ {
+  for ( auto _ : state ) bm::DoNotOptimize( osm::cursor_up( 1 ) );
+ }
+
+// osmanip_cursor_to_buffer
+static void osmanip_cursor_to_buffer( bm::State& state ) 
+ {
+  char buffer[ osm::CSI_MAX_SIZE ];
+  for ( auto _ : state ) bm::DoNotOptimize( osm::cursor_to( buffer, 0, 0 ) );
+ }
+
+// osmanip_decorator_insert
+static void osmanip_decorator_insert( bm::State& state ) 
+ {
+  osm::Decorator my_shell;
+  my_shell.setColor( "red", std::cout );
+  my_shell.setStyle( "bold underlined", std::cout );
+  for ( auto _ : state ) bm::DoNotOptimize( my_shell( std::cout ) << "Test" );
+ }
+
+// osmanip_stream_style_decor
+static void osmanip_stream_style_decor( bm::State& state ) 
+ {
+  using namespace osm::styles;
+  for ( auto _ : state ) bm::DoNotOptimize( std::cout << osm::decor( red | bold ) << "Test" << osm::decor( red ) << "Test" << osm::undecor );
+ }
+
+// osmanip_stream_style_push
+static void osmanip_stream_style_push( bm::State& state ) 
+ {
+  using namespace osm::styles;
+  for ( auto _ : state )
+   {
+    auto header = osm::push_style( std::cout, bold );
+    auto count = osm::push_style( std::cout, red );
+    bm::DoNotOptimize( std::cout << "Test" );
+   }
+ }
+
+// osmanip_style_registry_intern
+static void osmanip_style_registry_intern( bm::State& state ) 
+ {
+  using namespace osm::styles;
+  for ( auto _ : state ) bm::DoNotOptimize( osm::intern( red | bold ) );
+ }
+
+// osmanip_style_registry_sequence
+static void osmanip_style_registry_sequence( bm::State& state ) 
+ {
+  using namespace osm::styles;
+  const osm::StyleHandle handle = osm::intern( red | bold );
+  for ( auto _ : state ) bm::DoNotOptimize( handle.sequence() );
+ }
+
+// osmanip_gradient_sample
+static void osmanip_gradient_sample( bm::State& state ) 
+ {
+  const osm::Gradient gradient( { osm::Color::rgb( 255, 0, 0 ), osm::Color::rgb( 0, 255, 0 ) }, 256 );
+  size_t i = 0;
+  for ( auto _ : state ) bm::DoNotOptimize( std::cout << gradient.sample( i++ % 80, 80 ) << '#' );
+ }
+
+// osmanip_sgr_write
+static void osmanip_sgr_write( bm::State& state ) 
+ {
+  const osm::Style from { osm::Color::basic( 1 ), {}, osm::ATTR::BOLD };
+  const osm::Style to { osm::Color::basic( 2 ), {}, osm::ATTR::BOLD };
+  char buffer[ osm::SGR_MAX_SIZE ];
+  for ( auto _ : state ) bm::DoNotOptimize( osm::write_sgr( buffer, from, to ) );
+ }
+
+// osmanip_sgr_parse
+static void osmanip_sgr_parse( bm::State& state ) 
+ {
+  const std::string sequence = osm::feat( osm::col, "bd red" );
+  for ( auto _ : state ) bm::DoNotOptimize( osm::parse_sgr( sequence ) );
+ }
+
 // osmanip_printer_print
-/*static void osmanip_printer_print( bm::State& state ) 
+static void osmanip_printer_print( bm::State& state ) 
  {
   for ( auto _ : state ) bm::DoNotOptimize( osm::print( std::cout, "" ) );
  }
@@ -61,7 +160,21 @@ static void osmanip_cursor_go_to( bm::State& state )
 static void osmanip_printer_print_default( bm::State& state ) 
  {
   for ( auto _ : state ) bm::DoNotOptimize( osm::print( "" ) );
- }*/
+ }
+
+// osmanip_printer_print_styled
+static void osmanip_printer_print_styled( bm::State& state ) 
+ {
+  static constexpr osm::FormatString fmt( "{:red,bold} took {:.2f}s\n" );
+  for ( auto _ : state ) bm::DoNotOptimize( osm::print( std::cout, fmt, "build", 1.5 ) );
+ }
+
+// osmanip_printer_stream_styled
+static void osmanip_printer_stream_styled( bm::State& state ) 
+ {
+  for ( auto _ : state ) bm::DoNotOptimize( std::cout << osm::feat( osm::col, "red" ) << osm::feat( osm::sty, "bold" ) << "build" 
+                                                     << osm::feat( osm::rst, "all" ) << " took " << 1.5 << "s\n" << std::flush );
+ }
 
 //====================================================
 //     termcolor
@@ -80,10 +193,24 @@ static void termcolor_feat( bm::State& state )
 // osmanip
 BENCHMARK( osmanip_common_feat );
 BENCHMARK( osmanip_colsty_RGB );
+BENCHMARK( osmanip_colsty_rgb_fg );
+BENCHMARK( osmanip_colsty_rgb_fg_256 );
 BENCHMARK( osmanip_cursor_feat );
 BENCHMARK( osmanip_cursor_go_to );
-/*BENCHMARK( osmanip_printer_print );
-BENCHMARK( osmanip_printer_print_default );*/
+BENCHMARK( osmanip_cursor_up );
+BENCHMARK( osmanip_cursor_to_buffer );
+BENCHMARK( osmanip_decorator_insert );
+BENCHMARK( osmanip_stream_style_decor );
+BENCHMARK( osmanip_stream_style_push );
+BENCHMARK( osmanip_style_registry_intern );
+BENCHMARK( osmanip_style_registry_sequence );
+BENCHMARK( osmanip_gradient_sample );
+BENCHMARK( osmanip_sgr_write );
+BENCHMARK( osmanip_sgr_parse );
+BENCHMARK( osmanip_printer_print );
+BENCHMARK( osmanip_printer_print_default );
+BENCHMARK( osmanip_printer_print_styled );
+BENCHMARK( osmanip_printer_stream_styled );
 
 // termcolor
 BENCHMARK( termcolor_feat );
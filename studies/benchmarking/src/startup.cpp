@@ -0,0 +1,115 @@
+//====================================================
+//     Headers
+//====================================================
+
+// My headers, the whole library is linked in
+#include <osmanip/utility/iostream.hpp>
+
+// Extra headers
+#include <benchmark/benchmark.h>
+
+// System headers
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// STD headers
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+
+//====================================================
+//     Namespace directives
+//====================================================
+namespace bm = benchmark;
+
+//====================================================
+//     Variables
+//====================================================
+
+// Taken before any other static object of the program is initialized (GCC and clang only)
+static const std::chrono::steady_clock::time_point init_start __attribute__(( init_priority( 101 ) )) = std::chrono::steady_clock::now();
+
+extern char** environ;
+
+static constexpr std::string_view STATIC_INIT_FLAG = "--static-init";
+static std::string self_path;
+
+//====================================================
+//     Helpers
+//====================================================
+
+// run_self
+/**
+ * @brief Runs this executable in static initialization mode and returns what it prints, i.e. the time spent in static initialization in nanoseconds.
+ *
+ */
+static long long run_self()
+ {
+  int fds[ 2 ];
+  if( pipe( fds ) != 0 ) std::abort();
+
+  posix_spawn_file_actions_t actions;
+  posix_spawn_file_actions_init( &actions );
+  posix_spawn_file_actions_adddup2( &actions, fds[ 1 ], STDOUT_FILENO );
+  posix_spawn_file_actions_addclose( &actions, fds[ 0 ] );
+
+  std::string flag( STATIC_INIT_FLAG );
+  char* args[] = { self_path.data(), flag.data(), nullptr };
+  pid_t pid;
+  if( posix_spawn( &pid, self_path.c_str(), &actions, nullptr, args, environ ) != 0 ) std::abort();
+  posix_spawn_file_actions_destroy( &actions );
+  close( fds[ 1 ] );
+
+  char buffer[ 32 ] = {};
+  const ssize_t size = read( fds[ 0 ], buffer, sizeof( buffer ) - 1 );
+  close( fds[ 0 ] );
+  waitpid( pid, nullptr, 0 );
+
+  return size > 0 ? std::atoll( buffer ) : 0;
+ }
+
+//====================================================
+//     osmanip
+//====================================================
+
+// osmanip_startup_static_init
+static void osmanip_startup_static_init( bm::State& state )
+ {
+  for ( auto _ : state ) state.SetIterationTime( static_cast<double>( run_self() ) * 1e-9 );
+ }
+
+// osmanip_startup_process
+static void osmanip_startup_process( bm::State& state )
+ {
+  for ( auto _ : state ) bm::DoNotOptimize( run_self() );
+ }
+
+//====================================================
+//     Benchmarking settings
+//====================================================
+
+// osmanip
+BENCHMARK( osmanip_startup_static_init ) -> UseManualTime() -> Unit( bm::kMicrosecond );
+BENCHMARK( osmanip_startup_process ) -> UseRealTime() -> Unit( bm::kMicrosecond );
+
+//====================================================
+//     Main
+//====================================================
+int main( int argc, char** argv )
+ {
+  // Child mode: report the static initialization time and exit
+  if( argc > 1 && argv[ 1 ] == STATIC_INIT_FLAG )
+   {
+    const auto elapsed = std::chrono::steady_clock::now() - init_start;
+    std::printf( "%lld", static_cast<long long>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ) );
+    return 0;
+   }
+
+  self_path = argv[ 0 ];
+
+  bm::Initialize( &argc, argv );
+  bm::RunSpecifiedBenchmarks();
+ }
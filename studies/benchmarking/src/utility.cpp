@@ -0,0 +1,337 @@
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/utility/ansi_scan.hpp>
+#include <osmanip/utility/display_width.hpp>
+#include <osmanip/utility/html.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/output_redirector.hpp>
+#include <osmanip/utility/screen.hpp>
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/utility/sstream.hpp>
+#include <osmanip/utility/strings.hpp>
+
+// Extra headers
+#include <benchmark/benchmark.h>
+
+// STD headers
+#include <cstdio>
+#include <ostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <stddef.h>
+
+//====================================================
+//     Namespace directives
+//====================================================
+namespace bm = benchmark;
+
+//====================================================
+//     Helpers
+//====================================================
+
+// make_log
+/**
+ * @brief Builds a log like the one written by a program using osmanip: colored messages and progress bars updated in place.
+ *
+ */
+static std::string make_log( size_t size )
+ {
+  const std::string red = osm::feat( osm::col, "red" ), bold = osm::feat( osm::sty, "bold" ), reset = osm::feat( osm::rst, "all" );
+
+  std::string log;
+  log.reserve( size + 128 );
+  for( size_t line = 0; log.size() < size; line++ )
+   {
+    log += bold + "[INFO]" + reset + " Processing item " + std::to_string( line ) + " of the input file\n";
+    log += red + "Progress: " + reset;
+    for( int percent = 0; percent <= 100; percent += 25 )
+     {
+      log += "\033[" + std::to_string( 4 ) + "D" + std::to_string( percent ) + "%";
+     }
+    log += "\n";
+   }
+  return log;
+ }
+
+// CountingHandler
+/**
+ * @brief Handler doing the least possible work, to measure the parser alone.
+ *
+ */
+struct CountingHandler: public osm::AnsiHandler
+ {
+  size_t text_size = 0, sequences = 0;
+
+  void text( std::string_view run ) override { text_size += run.size(); }
+  void csi( const osm::AnsiCsi& ) override { sequences++; }
+  void sgr( const osm::Style& ) override { sequences++; }
+ };
+
+// scalar_strip_ansi
+/**
+ * @brief Reference implementation of strip_ansi, examining one character at a time.
+ *
+ */
+static std::string scalar_strip_ansi( const std::string& str )
+ {
+  std::string res;
+  res.reserve( str.size() );
+  for( size_t i = 0; i < str.size(); )
+   {
+    if( str[ i ] == '\033' ) i += osm::escape_size( str, i );
+    else res += str[ i++ ];
+   }
+  return res;
+ }
+
+// NullBuffer
+/**
+ * @brief Stream buffer discarding its output, to measure the converters alone.
+ *
+ */
+struct NullBuffer: public std::streambuf
+ {
+  std::streamsize xsputn( const char*, std::streamsize count ) override { return count; }
+  int overflow( int ch ) override { return ch; }
+ };
+
+//====================================================
+//     osmanip
+//====================================================
+
+// osmanip_ansi_parser_feed
+static void osmanip_ansi_parser_feed( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  osm::AnsiParser parser;
+  CountingHandler handler;
+  for ( auto _ : state )
+   {
+    parser.feed( log, handler );
+    bm::DoNotOptimize( handler.text_size );
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// osmanip_screen_write
+static void osmanip_screen_write( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  osm::Screen screen( 200, 50, 1000 );
+  for ( auto _ : state )
+   {
+    screen.write( log );
+    bm::DoNotOptimize( screen.cursorRow() );
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// osmanip_find_control
+static void osmanip_find_control( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  for ( auto _ : state )
+   {
+    size_t count = 0;
+    for( size_t i = osm::find_control( log ); i != std::string::npos; i = osm::find_control( log, i + 1 ) ) count++;
+    bm::DoNotOptimize( count );
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+  state.SetLabel( osm::scan_method() );
+ }
+
+// osmanip_strip_ansi
+static void osmanip_strip_ansi( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  std::string out;
+  for ( auto _ : state )
+   {
+    out.clear();
+    osm::strip_ansi( log, out );
+    bm::DoNotOptimize( out.data() );
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+  state.SetLabel( osm::scan_method() );
+ }
+
+// osmanip_strings_get_formatted_from_ansi
+static void osmanip_strings_get_formatted_from_ansi( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  for ( auto _ : state ) bm::DoNotOptimize( osm::get_formatted_from_ansi( log ) );
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// osmanip_display_width
+static void osmanip_display_width( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  for ( auto _ : state ) bm::DoNotOptimize( osm::display_width( log ) );
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// osmanip_display_width_cjk
+static void osmanip_display_width_cjk( bm::State& state )
+ {
+  std::string text;
+  while( text.size() < static_cast<size_t>( state.range( 0 ) ) ) text += "进度条 ████████░░ 80% 完成\n";
+  for ( auto _ : state ) bm::DoNotOptimize( osm::display_width( text ) );
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * text.size() ) );
+ }
+
+// osmanip_html_convert
+static void osmanip_html_convert( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  NullBuffer null_buffer;
+  std::ostream null_stream( &null_buffer );
+  osm::HtmlConverter converter( null_stream );
+  for ( auto _ : state )
+   {
+    converter.feed( log );
+    converter.end();
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// osmanip_output_redirector_flush
+static void osmanip_output_redirector_flush( bm::State& state )
+ {
+  const char* filename = "benchmark_redirection.txt";
+  std::remove( filename );
+  {
+    osm::OutputRedirector redirector( filename );
+    size_t line = 0;
+    for ( auto _ : state ) redirector << "Processing item " << line++ << " of the input file\n" << std::flush;
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+  }
+  std::remove( filename );
+ }
+
+// osmanip_output_redirector_progress
+static void osmanip_output_redirector_progress( bm::State& state )
+ {
+  const char* filename = "benchmark_redirection.txt";
+  std::remove( filename );
+  {
+    osm::OutputRedirector redirector( filename );
+    for ( size_t line = 0; line < osm::OutputRedirector::SCREEN_HEIGHT; line++ ) redirector << "Processing item " << line << " of the input file\n";
+    redirector << "Bars:\n[          ]   0%\n[          ]   0%" << std::flush;
+
+    // Redraws the first of two bars, followed by a line, as a multi-bar does
+    size_t step = 0;
+    for ( auto _ : state )
+     {
+      const size_t perc = step++ % 101;
+      redirector << "\033[1A\r[" << std::string( perc / 10, '#' ) << std::string( 10 - perc / 10, ' ' ) << "] " << perc << "%\033[1B\r" << std::flush;
+     }
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+  }
+  std::remove( filename );
+ }
+
+// osmanip_output_redirector_flush_async
+static void osmanip_output_redirector_flush_async( bm::State& state )
+ {
+  const char* filename = "benchmark_redirection.txt";
+  std::remove( filename );
+  {
+    osm::OutputRedirector redirector( filename );
+    redirector.setAsync( true );
+    size_t line = 0;
+    for ( auto _ : state ) redirector << "Processing item " << line++ << " of the input file\n" << std::flush;
+    redirector.flush();
+    state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+  }
+  std::remove( filename );
+ }
+
+// osmanip_cout_memory_sink
+static void osmanip_cout_memory_sink( bm::State& state )
+ {
+  osm::MemorySink sink;
+  osm::setSink( &sink );
+  size_t line = 0;
+  for ( auto _ : state )
+   {
+    osm::cout << "Processing item " << line++ << " of the input file\n" << std::flush;
+    if ( sink.str().size() > ( 1 << 20 ) ) sink.clear();
+   }
+  osm::setSink( nullptr );
+  state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+ }
+
+// osmanip_cout_stringstream
+static void osmanip_cout_stringstream( bm::State& state )
+ {
+  std::ostringstream captured;
+  auto& cout_buf = static_cast<osm::Ostreambuf&>( *osm::cout.rdbuf() );
+  std::ostream* terminal = cout_buf.getOstream();
+  cout_buf.setOstream( &captured );
+  size_t line = 0;
+  for ( auto _ : state )
+   {
+    osm::cout << "Processing item " << line++ << " of the input file\n" << std::flush;
+    if ( captured.tellp() > ( 1 << 20 ) ) captured.str( "" );
+   }
+  cout_buf.setOstream( terminal );
+  state.SetItemsProcessed( static_cast<int64_t>( state.iterations() ) );
+ }
+
+//====================================================
+//     scalar
+//====================================================
+
+// scalar_find_control
+static void scalar_find_control( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  for ( auto _ : state )
+   {
+    size_t count = 0;
+    for( char ch: log ) count += static_cast<unsigned char>( ch ) < 0x20;
+    bm::DoNotOptimize( count );
+   }
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+// scalar_strip_ansi
+static void scalar_strip_ansi( bm::State& state )
+ {
+  const std::string log = make_log( static_cast<size_t>( state.range( 0 ) ) );
+  for ( auto _ : state ) bm::DoNotOptimize( scalar_strip_ansi( log ) );
+  state.SetBytesProcessed( static_cast<int64_t>( state.iterations() * log.size() ) );
+ }
+
+//====================================================
+//     Benchmarking settings
+//====================================================
+
+// osmanip
+BENCHMARK( osmanip_ansi_parser_feed ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_screen_write ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_strings_get_formatted_from_ansi ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_find_control ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_strip_ansi ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_display_width ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_display_width_cjk ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_html_convert ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( osmanip_output_redirector_flush );
+BENCHMARK( osmanip_output_redirector_progress );
+BENCHMARK( osmanip_output_redirector_flush_async );
+BENCHMARK( osmanip_cout_memory_sink );
+BENCHMARK( osmanip_cout_stringstream );
+
+// scalar
+BENCHMARK( scalar_find_control ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+BENCHMARK( scalar_strip_ansi ) -> Arg( 1 << 16 ) -> Arg( 1 << 20 );
+
+BENCHMARK_MAIN();
@@ -9,6 +9,9 @@
 
 //My headers
 #include <osmanip/graphics/canvas.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/utility/options.hpp>
 
 //Extra headers
 #include <doctest/doctest.h>
@@ -57,4 +60,36 @@ TEST_CASE( "Testing the Canvas class methods." )
    }
 
   TEST_SUITE_END();
+ }
+
+//====================================================
+//     Testing "refresh" method
+//====================================================
+TEST_CASE( "Testing features which are not SGR sequences." )
+ {
+  const osm::ESCAPES escapes = osm::getEscapes();
+  osm::OPTION( osm::ESCAPES::ON );
+  osm::MemorySink sink;
+  osm::setSink( &sink );
+
+  // Text and other sequences in a feat are written as they are, before the char
+  osm::Canvas small( 3, 1 );
+  small.put( 0, 0, 'a', "<" );
+  small.put( 1, 0, 'b', osm::feat( osm::col, "red" ) + "\033]8;;x\033\\" );
+  small.put( 2, 0, 'c', osm::feat( osm::col, "red" ) );
+  small.refresh();
+  osm::setSink( nullptr );
+  CHECK_EQ( sink.str(), "<a\033[31m\033]8;;x\033\\bc\033[0m\n" );
+
+  // A cell overwritten with a plain style drops the text of its previous feat
+  sink.clear();
+  osm::setSink( &sink );
+  small.setBackground( '.', "|" );
+  small.clear();
+  small.put( 1, 0, 'b', osm::StyleHandle() );
+  small.refresh();
+  osm::setSink( nullptr );
+  CHECK_EQ( sink.str(), "\033[1A|.b|.\n" );
+
+  osm::OPTION( escapes );
  }
\ No newline at end of file
@@ -20,6 +20,9 @@
 //STD headers
 #include <string>
 #include <stdexcept>
+#include <thread>
+#include <vector>
+#include <atomic>
 
 //====================================================
 //     Using namespaces
@@ -35,4 +38,63 @@ TEST_CASE( "Testing the RGB function." )
   CHECK_EQ( osm::RGB( 1,5,2 ), "\x1b[38;2;1;5;2m" );
   CHECK_EQ( osm::RGB( 5,1,8 ), "\x1b[38;2;5;1;8m" );
  }
-#endif
\ No newline at end of file
+#endif
+
+//====================================================
+//     Testing the color encoders
+//====================================================
+TEST_CASE( "Testing the rgb_fg and rgb_bg color encoders." )
+ {
+  SUBCASE( "Testing the truecolor encoding." )
+   {
+    CHECK_EQ( osm::rgb_fg( 1, 5, 2, osm::COLORDEPTH::TRUECOLOR ), osm::RGB( 1, 5, 2 ) );
+    CHECK_EQ( osm::rgb_fg( 255, 128, 0, osm::COLORDEPTH::TRUECOLOR ), "\x1b[38;2;255;128;0m" );
+    CHECK_EQ( osm::rgb_bg( 10, 200, 99, osm::COLORDEPTH::TRUECOLOR ), "\x1b[48;2;10;200;99m" );
+    CHECK_EQ( osm::rgb_fg( 1, 2, 3, osm::COLORDEPTH::NONE ), "" );
+
+    char buffer[ osm::SGR_COLOR_MAX_SIZE ];
+    char* end = osm::rgb_bg( buffer, 255, 255, 255, osm::COLORDEPTH::TRUECOLOR );
+    CHECK_EQ( std::string( buffer, end ), "\x1b[48;2;255;255;255m" );
+   }
+
+  SUBCASE( "Testing the xterm-256 downsampling." )
+   {
+    CHECK_EQ( osm::rgb_to_256( 0, 0, 0 ), 16 );
+    CHECK_EQ( osm::rgb_to_256( 255, 0, 0 ), 196 );
+    CHECK_EQ( osm::rgb_to_256( 95, 135, 175 ), 16 + 36 * 1 + 6 * 2 + 3 );
+    CHECK_EQ( osm::rgb_to_256( 128, 128, 128 ), 244 );
+    CHECK_EQ( osm::rgb_to_256( 255, 255, 255 ), 231 );
+    CHECK_EQ( osm::rgb_fg( 255, 0, 0, osm::COLORDEPTH::C256 ), "\x1b[38;5;196m" );
+    CHECK_EQ( osm::rgb_bg( 8, 8, 8, osm::COLORDEPTH::C256 ), "\x1b[48;5;232m" );
+   }
+
+  SUBCASE( "Testing the 16 colors downsampling." )
+   {
+    CHECK_EQ( osm::rgb_to_16( 0, 0, 0 ), 0 );
+    CHECK_EQ( osm::rgb_to_16( 200, 10, 10 ), 1 );
+    CHECK_EQ( osm::rgb_to_16( 255, 255, 255 ), 15 );
+    CHECK_EQ( osm::rgb_fg( 200, 10, 10, osm::COLORDEPTH::C16 ), "\x1b[31m" );
+    CHECK_EQ( osm::rgb_fg( 250, 250, 0, osm::COLORDEPTH::C16 ), "\x1b[93m" );
+    CHECK_EQ( osm::rgb_bg( 0, 0, 250, osm::COLORDEPTH::C16 ), "\x1b[44m" );
+    CHECK_EQ( osm::rgb_bg( 255, 255, 255, osm::COLORDEPTH::C16 ), "\x1b[107m" );
+   }
+
+  SUBCASE( "Testing concurrent calls." )
+   {
+    std::vector<std::thread> threads;
+    std::atomic<int32_t> errors { 0 };
+    for( int32_t t = 0; t < 4; t++ )
+     {
+      threads.emplace_back( [ t, &errors ]
+       {
+        for( int32_t i = 0; i < 1000; i++ )
+         {
+          const std::string expected = "\x1b[38;2;" + std::to_string( t ) + ";" + std::to_string( i ) + ";7m";
+          if( osm::RGB( t, i, 7 ) != expected ) errors++;
+         }
+       } );
+     }
+    for( auto& thread: threads ) thread.join();
+    CHECK_EQ( errors.load(), 0 );
+   }
+ }
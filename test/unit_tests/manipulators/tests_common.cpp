@@ -11,6 +11,7 @@
 //My headers
 #include <osmanip/manipulators/common.hpp>
 #include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/utility/options.hpp>
 #ifdef _WIN32
 #include <osmanip/utility/windows.hpp>
 #endif
@@ -38,6 +39,9 @@ int main( int argc, char** argv )
   osm::enableANSI();
   #endif
 
+  // Tests check the emitted sequences, which must not depend on where the output goes
+  osm::OPTION( osm::ESCAPES::ON );
+
   doctest::Context context;
 
   context.setOption( "abort-after", 5 ); 
@@ -79,4 +83,20 @@ TEST_CASE( "Testing the feat function." )
   CHECK_THROWS_MESSAGE( osm::feat( osm::col, "not" ), test_string );
   CHECK_THROWS_AS( osm::feat( osm::sty, "not" ), std::runtime_error );
   CHECK_THROWS_MESSAGE( osm::feat( osm::sty, "not" ), test_string );
+ }
+
+//====================================================
+//     Testing FeatureMap class
+//====================================================
+TEST_CASE( "Testing the FeatureMap class." )
+ {
+  static constexpr osm::feat_table_entry table[] { { "error", "Inserted test feature" }, { "red", "\033[31m" } };
+  static const osm::feature_map test_map( table );      // Static, as its map is never freed
+
+  CHECK_EQ( test_map.size(), 2 );
+  CHECK_EQ( &test_map.map(), &test_map.map() );
+  CHECK_EQ( test_map.at( "red" ), "\033[31m" );
+  CHECK_EQ( test_map.count( "green" ), 0 );
+  CHECK_EQ( osm::feat( test_map, "red" ), "\033[31m" );
+  CHECK_EQ( osm::col.find( "red" ) -> second, "\033[31m" );
  }
\ No newline at end of file
@@ -16,6 +16,7 @@
 //STD headers
 #include <string>
 #include <stdexcept>
+#include <sstream>
 
 //====================================================
 //     Using namespaces
@@ -50,4 +51,47 @@ TEST_CASE( "Testing the go_to function." )
                                               std::to_string( 5 ) + "H"s;
 
   CHECK_EQ( osm::go_to( 2, 5 ), test_string_goto );
- }
\ No newline at end of file
+ }
+
+//====================================================
+//     Testing the parameterized cursor functions
+//====================================================
+TEST_CASE( "Testing the parameterized cursor and control sequence functions." )
+ {
+  SUBCASE( "Testing the convenience forms." )
+   {
+    CHECK_EQ( osm::cursor_up( 3 ), "\u001b[3A" );
+    CHECK_EQ( osm::cursor_down( 12 ), "\u001b[12B" );
+    CHECK_EQ( osm::cursor_right( 1 ), "\u001b[1C" );
+    CHECK_EQ( osm::cursor_left( 100 ), "\u001b[100D" );
+    CHECK_EQ( osm::cursor_to( 2, 5 ), osm::go_to( 2, 5 ) );
+    CHECK_EQ( osm::clear_line(), "\u001b[0K" );
+    CHECK_EQ( osm::clear_line( 2 ), "\u001b[2K" );
+    CHECK_EQ( osm::clear_screen( 2 ), "\u001b[2J" );
+
+    // Same results of the map-based interface
+    CHECK_EQ( osm::cursor_up( 7 ), osm::feat( osm::crs, "up", 7 ) );
+    CHECK_EQ( osm::clear_line( 1 ), osm::feat( osm::tcsc, "cln", 1 ) );
+    CHECK_EQ( "x" + osm::cursor_left( 4 ), "x\u001b[4D"s );
+   }
+
+  SUBCASE( "Testing the buffer writers." )
+   {
+    char buffer[ osm::CSI_MAX_SIZE ];
+
+    char* end = osm::cursor_to( buffer, -2147483647 - 1, 2147483647 );
+    CHECK_EQ( std::string( buffer, end ), "\u001b[-2147483648;2147483647H" );
+    CHECK_LE( end - buffer, osm::CSI_MAX_SIZE );
+
+    end = osm::cursor_up( buffer, 0 );
+    CHECK_EQ( std::string( buffer, end ), "\u001b[0A" );
+   }
+
+  SUBCASE( "Testing the stream writers." )
+   {
+    std::ostringstream oss;
+    osm::cursor_up( oss, 1 );
+    osm::clear_line( oss ) << "text";
+    CHECK_EQ( oss.str(), "\u001b[1A\u001b[0Ktext" );
+   }
+ }
@@ -18,6 +18,8 @@
 //STD headers
 #include <streambuf>
 #include <sstream>
+#include <thread>
+#include <type_traits>
 
 //====================================================
 //     Testing OS_Decorator
@@ -136,7 +138,7 @@ TEST_CASE( "Testing the OS_Decorator class methods." )
     my_shell.setStyle( "bold", buffer );
 
     my_shell( buffer ) << "Test";
-    CHECK_EQ( buffer.str(), "\033[31m\033[1mTest\033[0m" );
+    CHECK_EQ( buffer.str(), "\033[1;31mTest\033[0m" );
     buffer.str( "" );
     buffer.clear();
 
@@ -148,10 +150,47 @@ TEST_CASE( "Testing the OS_Decorator class methods." )
 
     my_shell.resetStyle( buffer );
     my_shell( buffer ) << "Test";
-    CHECK_EQ( buffer.str(), "Test\033[0m" );
+    CHECK_EQ( buffer.str(), "Test" );
     buffer.str( "" );
     buffer.clear();
    }
 
+  SUBCASE( "Testing the settings kept in the streams." )
+   {
+    static_assert( std::is_same_v<decltype( my_shell( osm::cout ) ), const osm::Decorator&> );
+
+    std::stringstream first, second;
+    {
+     osm::Decorator copied;
+     copied.setColor( "red", first );
+     my_shell = copied;
+     copied.setColor( "blue", first );
+     CHECK_EQ( my_shell.getColor( first ), "red" );
+
+     osm::Decorator copy( copied );
+     CHECK_EQ( copy.getColor( first ), "blue" );
+     CHECK_EQ( osm::find_stream_style( first ) -> decorators.size(), 3 );
+    }
+    CHECK_EQ( osm::find_stream_style( first ) -> decorators.size(), 1 );
+
+    // Each thread inserts into the stream it selected
+    my_shell.setColor( "green", second );
+    std::thread other( [ & ] { for( int i = 0; i < 1000; i++ ) my_shell( second ) << "b"; } );
+    for( int i = 0; i < 1000; i++ ) my_shell( first ) << "a";
+    other.join();
+    CHECK_EQ( first.str().find( 'b' ), std::string::npos );
+    CHECK_EQ( second.str().find( 'a' ), std::string::npos );
+
+    // Destroyed streams are no longer listed
+    {
+     std::stringstream destroyed;
+     my_shell.setColor( "red", destroyed );
+     CHECK_EQ( my_shell.getColorList().size(), 3 );
+    }
+    CHECK_EQ( my_shell.getColorList().size(), 2 );
+    my_shell.resetColor( first );
+    my_shell.resetColor( second );
+   }
+
   TEST_SUITE_END();
  }
\ No newline at end of file
@@ -0,0 +1,68 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/gradient.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/graphics/canvas.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <stdexcept>
+
+//====================================================
+//     Testing "Gradient" class
+//====================================================
+TEST_CASE( "Testing the Gradient class." )
+ {
+  const osm::Color red = osm::Color::rgb( 255, 0, 0 ), green = osm::Color::rgb( 0, 255, 0 );
+
+  SUBCASE( "Testing the lookup table." )
+   {
+    const osm::Gradient gradient( { red, green }, 5, false, osm::COLORDEPTH::TRUECOLOR );
+
+    CHECK_EQ( gradient.size(), 5 );
+    CHECK( gradient.at( 0 ).style().fg == red );
+    CHECK( gradient.at( 2 ).style().fg == osm::Color::rgb( 128, 128, 0 ) );
+    CHECK( gradient.at( 4 ).style().fg == green );
+    CHECK_EQ( gradient.at( 4 ).sequence(), "\033[38;2;0;255;0m" );
+
+    // Stretched over more cells and sampled by position
+    CHECK( gradient.sample( 0, 9 ) == gradient.at( 0 ) );
+    CHECK( gradient.sample( 4, 9 ) == gradient.at( 2 ) );
+    CHECK( gradient.sample( 8, 9 ) == gradient.at( 4 ) );
+    CHECK( gradient.sample( 20, 9 ) == gradient.at( 4 ) );
+    CHECK( gradient.sample( 0.5 ) == gradient.at( 2 ) );
+    CHECK( gradient.sample( -1.0 ) == gradient.at( 0 ) );
+    CHECK( gradient.sample( 2.0 ) == gradient.at( 4 ) );
+    CHECK( osm::Gradient().sample( 0.5 ).isDefault() );
+   }
+
+  SUBCASE( "Testing the color depths." )
+   {
+    CHECK( osm::Gradient( { red }, 1, false, osm::COLORDEPTH::C256 ).at( 0 ).style().fg == osm::Color::indexed( 196 ) );
+    CHECK( osm::Gradient( { red }, 1, false, osm::COLORDEPTH::C16 ).at( 0 ).style().fg.type == osm::COLORTYPE::BASIC );
+    CHECK( osm::Gradient( { red }, 1, false, osm::COLORDEPTH::NONE ).at( 0 ).isDefault() );
+    CHECK( osm::Gradient( { red }, 1, true, osm::COLORDEPTH::TRUECOLOR ).at( 0 ).style().bg == red );
+   }
+
+  SUBCASE( "Testing exceptions." )
+   {
+    CHECK_THROWS_AS( osm::Gradient( {}, 5 ), std::invalid_argument );
+    CHECK_THROWS_AS( osm::Gradient( { osm::Color::basic( 1 ) }, 5 ), std::invalid_argument );
+
+    osm::Canvas canvas( 4, 3 );
+    const osm::Gradient gradient( { red, green }, 4, false, osm::COLORDEPTH::TRUECOLOR );
+    CHECK_NOTHROW( canvas.fillGradient( 0, 0, 4, 3, '#', gradient ) );
+    CHECK_THROWS_AS( canvas.fillGradient( 1, 0, 4, 1, '#', gradient ), std::out_of_range );
+   }
+ }
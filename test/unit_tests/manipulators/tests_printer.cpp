@@ -0,0 +1,126 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/printer.hpp>
+#include <osmanip/utility/options.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <stdexcept>
+
+//====================================================
+//     Helpers
+//====================================================
+struct Point
+ {
+  int x, y;
+ };
+
+std::ostream& operator << ( std::ostream& os, const Point& p )
+ {
+  return os << "(" << p.x << ", " << p.y << ")";
+ }
+
+//====================================================
+//     Testing "FormatString" class
+//====================================================
+TEST_CASE( "Testing the FormatString class." )
+ {
+  using namespace std::literals::string_view_literals;
+
+  // Parsed at compile time
+  constexpr osm::FormatString fmt( "{:red,bold} took {:.2f}s {{}}\n" );
+  static_assert( fmt.fields() == 2 );
+  static_assert( fmt.text() == " took s {}\n"sv );
+  static_assert( fmt.prefix( 0 ) == "\033[31;1m"sv );
+  static_assert( fmt.prefix( 1 ).empty() );
+  static_assert( fmt.field( 1 ).spec.precision == 2 && fmt.field( 1 ).spec.type == 'f' );
+
+  constexpr osm::FormatString spec( "{:*^+08.3e}" );
+  static_assert( spec.field( 0 ).spec.fill == '*' && spec.field( 0 ).spec.align == '^' );
+  static_assert( spec.field( 0 ).spec.sign == '+' && spec.field( 0 ).spec.zero && spec.field( 0 ).spec.width == 8 );
+
+  // Errors
+  CHECK_THROWS_AS( osm::FormatString( "{" ), std::invalid_argument );
+  CHECK_THROWS_AS( osm::FormatString( "}" ), std::invalid_argument );
+  CHECK_THROWS_AS( osm::FormatString( "{0}" ), std::invalid_argument );
+  CHECK_THROWS_AS( osm::FormatString( "{:5,6}" ), std::invalid_argument );
+  CHECK_THROWS_AS( osm::FormatString( "{:.2q}" ), std::invalid_argument );
+  CHECK_THROWS_AS( osm::FormatString( "{:ciccio}" ), std::runtime_error );
+ }
+
+//====================================================
+//     Testing "print" function
+//====================================================
+TEST_CASE( "Testing the print function." )
+ {
+  std::ostringstream oss;
+  const auto& printed = [ &oss ]() { std::string str = oss.str(); oss.str( "" ); return str; };
+
+  SUBCASE( "Testing styles." )
+   {
+    osm::print( oss, "{:red,bold} took {:.2f}s\n", "build", 1.5 );
+    CHECK_EQ( printed(), "\033[31;1mbuild\033[0m took 1.50s\n" );
+
+    osm::OPTION( osm::ESCAPES::OFF );
+    osm::print( oss, "{:red,bold} took {:.2f}s\n", "build", 1.5 );
+    CHECK_EQ( printed(), "build took 1.50s\n" );
+    osm::OPTION( osm::ESCAPES::ON );
+   }
+
+  SUBCASE( "Testing values." )
+   {
+    osm::print( oss, "{} {} {} {} {} {}", 42, -7L, 3u, true, 'c', std::string( "str" ) );
+    CHECK_EQ( printed(), "42 -7 3 true c str" );
+
+    osm::print( oss, "{:x} {:X} {:o} {:b} {:c} {:d}", 255, 255, 8, 5, 65, 'A' );
+    CHECK_EQ( printed(), "ff FF 10 101 A 65" );
+
+    osm::print( oss, "{} {:.3f} {:e} {:+g}", 0.25, 2.0, 1e10, 3.0f );
+    CHECK_EQ( printed(), "0.25 2.000 1.000000e+10 +3" );
+
+    osm::print( oss, "{} {:.2}", Point{ 1, 2 }, "abcdef" );
+    CHECK_EQ( printed(), "(1, 2) ab" );
+   }
+
+  SUBCASE( "Testing alignment." )
+   {
+    osm::print( oss, "[{:5}][{:5}][{:^5}][{:*<4}][{:05}][{:+06.1f}]", 12, "ab", "ab", 1, -12, 2.5 );
+    CHECK_EQ( printed(), "[   12][ab   ][ ab  ][1***][-0012][+002.5]" );
+
+    osm::print( oss, "[{:green,>4}]", 7 );
+    CHECK_EQ( printed(), "[\033[32m   7\033[0m]" );
+
+    osm::print( oss, "[{:<6}][{:>4}]", "日本", "\033[1m■\033[0m" );
+    CHECK_EQ( printed(), "[日本  ][   \033[1m■\033[0m]" );
+   }
+
+  SUBCASE( "Testing format strings parsed at compile time." )
+   {
+    osm::print( oss, OSMANIP_FORMAT( "{:red,bold} took {:.2f}s\n" ), "build", 1.5 );
+    CHECK_EQ( printed(), "\033[31;1mbuild\033[0m took 1.50s\n" );
+
+#if defined( __cpp_nontype_template_args ) && __cpp_nontype_template_args >= 201911L
+    osm::print<"[{:green,>4}]">( oss, 7 );
+    CHECK_EQ( printed(), "[\033[32m   7\033[0m]" );
+#endif
+   }
+
+  SUBCASE( "Testing errors." )
+   {
+    CHECK_THROWS_AS( osm::print( oss, "{} {}", 1 ), std::invalid_argument );
+    CHECK_EQ( printed(), "" );
+   }
+ }
@@ -0,0 +1,130 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <string>
+#include <sstream>
+
+//====================================================
+//     Testing "parse_sgr" function
+//====================================================
+TEST_CASE( "Testing the parse_sgr function." )
+ {
+  const osm::Style red { osm::Color::basic( 1 ), {}, osm::ATTR::NONE };
+
+  CHECK( osm::parse_sgr( "" ).isDefault() );
+  CHECK( osm::parse_sgr( osm::feat( osm::col, "red" ) ) == red );
+  CHECK( osm::parse_sgr( osm::feat( osm::col, "bd red" ) ) == osm::Style{ osm::Color::basic( 1 ), {}, osm::ATTR::BOLD } );
+  CHECK( osm::parse_sgr( osm::feat( osm::col, "bg lt cyan" ) ).bg == osm::Color::basic( 14 ) );
+  CHECK( osm::parse_sgr( osm::feat( osm::sty, "italics" ) + osm::feat( osm::sty, "d-underlined" ) ).attrs == ( osm::ATTR::ITALICS | osm::ATTR::D_UNDERLINED ) );
+  CHECK( osm::parse_sgr( osm::RGB( 1, 2, 3 ) ).fg == osm::Color::rgb( 1, 2, 3 ) );
+  CHECK( osm::parse_sgr( "\033[48;5;196m" ).bg == osm::Color::indexed( 196 ) );
+
+  // Sub-parameters only apply to the code they follow
+  CHECK( osm::parse_sgr( "\033[38:2:1:2:3m" ).fg == osm::Color::rgb( 1, 2, 3 ) );
+  CHECK( osm::parse_sgr( "\033[38:2::1:2:3;1m" ) == osm::Style{ osm::Color::rgb( 1, 2, 3 ), {}, osm::ATTR::BOLD } );
+  CHECK( osm::parse_sgr( "\033[4:2m" ).attrs == osm::ATTR::D_UNDERLINED );
+  CHECK( osm::parse_sgr( "\033[4:3m" ).attrs == osm::ATTR::UNDERLINED );
+  CHECK( osm::parse_sgr( "\033[58;5;3m" ).isDefault() );
+
+  // Applied on top of a base style
+  CHECK( osm::parse_sgr( "\033[22m", osm::Style{ {}, {}, osm::ATTR::BOLD | osm::ATTR::ITALICS } ).attrs == osm::ATTR::ITALICS );
+  CHECK( osm::parse_sgr( "\033[0m", red ).isDefault() );
+  CHECK( osm::parse_sgr( "\033[m", red ).isDefault() );
+  CHECK( osm::parse_sgr( osm::feat( osm::rst, "bd color" ), osm::parse_sgr( "\033[1;31m" ) ).isDefault() );
+ }
+
+//====================================================
+//     Testing "strip_sgr" function
+//====================================================
+TEST_CASE( "Testing the strip_sgr function." )
+ {
+  CHECK_EQ( osm::strip_sgr( "" ), "" );
+  CHECK_EQ( osm::strip_sgr( osm::feat( osm::col, "red" ) + osm::feat( osm::sty, "bold" ) ), "" );
+  CHECK_EQ( osm::strip_sgr( "<\033[1;31m>\033[m" ), "<>" );
+
+  // Other sequences and incomplete ones are kept
+  CHECK_EQ( osm::strip_sgr( "\033[31m\033[2A\033]8;;x\033\\" ), "\033[2A\033]8;;x\033\\" );
+  CHECK_EQ( osm::strip_sgr( "a\033[3" ), "a\033[3" );
+ }
+
+//====================================================
+//     Testing "write_sgr" function
+//====================================================
+TEST_CASE( "Testing the write_sgr function." )
+ {
+  const osm::Style def;
+  const osm::Style red { osm::Color::basic( 1 ), {}, osm::ATTR::NONE };
+  const osm::Style bold_red { osm::Color::basic( 1 ), {}, osm::ATTR::BOLD };
+  const osm::Style faint_red { osm::Color::basic( 1 ), {}, osm::ATTR::FAINT };
+
+  CHECK_EQ( osm::sgr( def, def ), "" );
+  CHECK_EQ( osm::sgr( red, red ), "" );
+  CHECK_EQ( osm::sgr( def, red ), "\033[31m" );
+  CHECK_EQ( osm::sgr( def, bold_red ), "\033[1;31m" );
+  CHECK_EQ( osm::sgr( red, bold_red ), "\033[1m" );
+  CHECK_EQ( osm::sgr( bold_red, def ), "\033[0m" );
+
+  // Bold and faint are turned off together
+  CHECK_EQ( osm::sgr( bold_red, faint_red ), "\033[22;2m" );
+
+  // A reset is chosen when shorter
+  CHECK_EQ( osm::sgr( osm::Style{ {}, {}, osm::ATTR::BOLD | osm::ATTR::FAINT }, osm::Style{ {}, {}, osm::ATTR::FAINT } ), "\033[0;2m" );
+  CHECK_EQ( osm::sgr( osm::Style{ osm::Color::rgb( 1, 2, 3 ), osm::Color::indexed( 7 ), osm::ATTR::BOLD | osm::ATTR::ITALICS }, red ), "\033[0;31m" );
+
+  // Every kind of color
+  CHECK_EQ( osm::sgr( def, osm::Style{ osm::Color::basic( 9 ), osm::Color::basic( 15 ), osm::ATTR::NONE } ), "\033[91;107m" );
+  CHECK_EQ( osm::sgr( def, osm::Style{ osm::Color::rgb( 255, 0, 10 ), osm::Color::indexed( 232 ), osm::ATTR::NONE } ), "\033[38;2;255;0;10;48;5;232m" );
+
+  // The worst case fits the buffer
+  const osm::Style worst { osm::Color::rgb( 255, 255, 255 ), osm::Color::rgb( 255, 255, 255 ), ~osm::ATTR::NONE };
+  char buffer[ osm::SGR_MAX_SIZE ];
+  CHECK( osm::write_sgr( buffer, osm::Style{ osm::Color::rgb( 0, 0, 0 ), {}, osm::ATTR::NONE }, worst ) - buffer <= static_cast<std::ptrdiff_t>( osm::SGR_MAX_SIZE ) );
+ }
+
+//====================================================
+//     Testing "SgrState" class
+//====================================================
+TEST_CASE( "Testing the SgrState class." )
+ {
+  const osm::Style red { osm::Color::basic( 1 ), {}, osm::ATTR::NONE };
+  const osm::Style bold_red { osm::Color::basic( 1 ), {}, osm::ATTR::BOLD };
+
+  std::ostringstream oss;
+  osm::SgrState state;
+
+  state.apply( oss, red ) << "a";
+  state.apply( oss, red ) << "b";
+  state.apply( oss, bold_red ) << "c";
+  state.reset( oss );
+  state.reset( oss );
+
+  CHECK_EQ( oss.str(), "\033[31mab\033[1mc\033[0m" );
+  CHECK( state.current().isDefault() );
+
+  // Layered over a base style, without whole resets
+  const osm::Style bold { {}, {}, osm::ATTR::BOLD };
+  const osm::Style underlined_red { osm::Color::basic( 1 ), {}, osm::ATTR::UNDERLINED };
+  oss.str( "" );
+  osm::SgrState over = osm::SgrState::over( bold );
+  over.apply( oss, red ) << "a";
+  over.apply( oss, underlined_red ) << "b";
+  over.apply( oss, osm::Style{} ) << "c";
+  over.reset( oss );
+
+  CHECK_EQ( oss.str(), "\033[31ma\033[4mb\033[24;39mc" );
+  CHECK( over.current() == bold );
+ }
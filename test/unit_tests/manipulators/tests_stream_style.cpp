@@ -0,0 +1,138 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/stream_style.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <string>
+#include <sstream>
+#include <functional>
+#include <utility>
+#include <thread>
+
+//====================================================
+//     Testing "Style" constants
+//====================================================
+TEST_CASE( "Testing the Style constants." )
+ {
+  using namespace osm::styles;
+
+  CHECK( ( red | bold ) == osm::Style{ osm::Color::basic( 1 ), {}, osm::ATTR::BOLD } );
+  CHECK( ( red | bg_blue | italics | bold ) == osm::Style{ osm::Color::basic( 1 ), osm::Color::basic( 4 ), osm::ATTR::BOLD | osm::ATTR::ITALICS } );
+  CHECK( ( red | green ) == green );
+  CHECK( ( bold | osm::Style{} ) == bold );
+ }
+
+//====================================================
+//     Testing "decor" manipulator
+//====================================================
+TEST_CASE( "Testing the decor manipulator." )
+ {
+  using namespace osm::styles;
+
+  SUBCASE( "Testing the emitted sequences." )
+   {
+    std::ostringstream oss;
+    CHECK_EQ( osm::find_stream_style( oss ), nullptr );
+
+    oss << osm::undecor << "a";
+    CHECK_EQ( osm::find_stream_style( oss ), nullptr );
+
+    oss << osm::decor( red | bold ) << "b" << osm::decor( red | bold ) << "c" << osm::decor( red ) << "d" << osm::undecor;
+    CHECK_EQ( oss.str(), "a\033[1;31mbc\033[22md\033[0m" );
+    CHECK( osm::current_style( oss ).isDefault() );
+   }
+
+  SUBCASE( "Testing the state of the stream." )
+   {
+    std::ostringstream first, second;
+    first << osm::decor( blue );
+    second << osm::decor( bold );
+
+    CHECK( osm::current_style( first ) == blue );
+    CHECK( osm::current_style( second ) == bold );
+
+    // Copied together with the other formatting state
+    std::ostringstream copy;
+    copy.copyfmt( first );
+    CHECK( osm::current_style( copy ) == blue );
+    copy << osm::decor( green );
+    CHECK( osm::current_style( first ) == blue );
+    CHECK_EQ( copy.str(), "\033[32m" );
+   }
+
+  SUBCASE( "Testing different streams in different threads." )
+   {
+    std::ostringstream first, second;
+    const auto& write = []( std::ostringstream& oss, const osm::Style& style )
+     {
+      for( int i = 0; i < 1000; i++ ) oss << osm::decor( style ) << "x" << osm::undecor;
+     };
+
+    std::thread first_thread( write, std::ref( first ), red );
+    std::thread second_thread( write, std::ref( second ), bold );
+    first_thread.join();
+    second_thread.join();
+
+    std::string expected;
+    for( int i = 0; i < 1000; i++ ) expected += "\033[31mx\033[0m";
+    CHECK_EQ( first.str(), expected );
+    CHECK( osm::current_style( second ).isDefault() );
+   }
+ }
+
+//====================================================
+//     Testing "push_style" function
+//====================================================
+TEST_CASE( "Testing the push_style function." )
+ {
+  using namespace osm::styles;
+
+  SUBCASE( "Testing nested scopes." )
+   {
+    std::ostringstream oss;
+     {
+      auto header = osm::push_style( oss, bold );
+      oss << "Errors: ";
+       {
+        auto count = osm::push_style( oss, red );
+        oss << 3;
+        CHECK( osm::current_style( oss ) == ( bold | red ) );
+       }
+      oss << " found";
+      CHECK( osm::current_style( oss ) == bold );
+     }
+
+    CHECK_EQ( oss.str(), "\033[1mErrors: \033[31m3\033[39m found\033[0m" );
+    CHECK( osm::current_style( oss ).isDefault() );
+    CHECK( osm::find_stream_style( oss ) -> stack.empty() );
+   }
+
+  SUBCASE( "Testing pop and moved scopes." )
+   {
+    std::ostringstream oss;
+    oss << osm::decor( green );
+
+    auto outer = osm::push_style( oss, underlined );
+    auto inner = osm::push_style( oss, italics );
+    auto moved = std::move( inner );
+
+    // Closing the outer scope closes the inner one too
+    outer.pop();
+    CHECK( osm::current_style( oss ) == green );
+    moved.pop();
+    outer.pop();
+    CHECK_EQ( oss.str(), "\033[32m\033[4m\033[3m\033[0;32m" );
+   }
+ }
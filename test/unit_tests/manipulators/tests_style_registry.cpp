@@ -0,0 +1,96 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/style_registry.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/decorator.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <string>
+#include <sstream>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//====================================================
+//     Testing "intern" function
+//====================================================
+TEST_CASE( "Testing the intern function." )
+ {
+  using namespace osm::styles;
+
+  SUBCASE( "Testing the handles." )
+   {
+    CHECK( osm::intern( osm::Style{} ).isDefault() );
+    CHECK( osm::intern( "" ) == osm::StyleHandle() );
+
+    // Handles of styles never interned cannot be made
+    static_assert( ! std::is_constructible_v<osm::StyleHandle, uint16_t> );
+
+    const osm::StyleHandle bold_red = osm::intern( red | bold );
+    CHECK( ! bold_red.isDefault() );
+    CHECK( bold_red == osm::intern( bold | red ) );
+    CHECK( bold_red == osm::intern( osm::feat( osm::col, "bd red" ) ) );
+    CHECK( bold_red != osm::intern( red ) );
+    CHECK( bold_red.style() == ( red | bold ) );
+    CHECK_EQ( bold_red.sequence(), "\033[1;31m" );
+    CHECK( osm::StyleHandle().style().isDefault() );
+    CHECK_EQ( osm::StyleHandle().sequence(), "" );
+
+    const size_t size = osm::interned_styles();
+    osm::intern( red | bold );
+    CHECK_EQ( osm::interned_styles(), size );
+
+    std::ostringstream oss;
+    oss << bold_red << "Test" << osm::StyleHandle();
+    CHECK_EQ( oss.str(), "\033[1;31mTest" );
+   }
+
+  SUBCASE( "Testing concurrent interning." )
+   {
+    std::vector<osm::StyleHandle> first( 256 ), second( 256 );
+    const auto& fill = []( std::vector<osm::StyleHandle>& handles )
+     {
+      for( size_t i = 0; i < handles.size(); i++ ) handles[ i ] = osm::intern( osm::Style{ osm::Color::indexed( static_cast<uint8_t>( i ) ), {}, osm::ATTR::UNDERLINED } );
+     };
+
+    std::thread first_thread( fill, std::ref( first ) );
+    std::thread second_thread( fill, std::ref( second ) );
+    first_thread.join();
+    second_thread.join();
+
+    CHECK( first == second );
+    CHECK( first[ 200 ].style().fg == osm::Color::indexed( 200 ) );
+   }
+ }
+
+//====================================================
+//     Testing handles in the Decorator
+//====================================================
+TEST_CASE( "Testing the style handles in the Decorator." )
+ {
+  osm::Decorator my_shell;
+  std::stringstream buffer;
+
+  my_shell.setColor( "red", buffer );
+  my_shell.setStyle( osm::intern( osm::styles::underlined ), buffer );
+  CHECK( my_shell.getStyleHandle( buffer ) == osm::intern( osm::styles::underlined ) );
+
+  my_shell( buffer ) << "Test";
+  CHECK_EQ( buffer.str(), "\033[4;31mTest\033[0m" );
+
+  my_shell.resetStyle( buffer );
+  CHECK( my_shell.getStyleHandle( buffer ).isDefault() );
+ }
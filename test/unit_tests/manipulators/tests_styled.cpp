@@ -0,0 +1,84 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+//My headers
+#include <osmanip/manipulators/styled.hpp>
+#include <osmanip/utility/options.hpp>
+
+//Extra headers
+#include <doctest/doctest.h>
+
+//STD headers
+#include <string>
+#include <string_view>
+#include <sstream>
+#include <stdexcept>
+
+//====================================================
+//     Testing "styled" function
+//====================================================
+TEST_CASE( "Testing the styled function." )
+ {
+  using namespace std::literals::string_view_literals;
+
+  // Built at compile time
+  constexpr auto label = osm::styled( "red", "bold" )( "Error:" );
+  static_assert( label.str() == "\033[31;1mError:\033[0m"sv );
+  static_assert( label.text() == "Error:"sv );
+
+  constexpr auto plain = osm::styled()( "text" );
+  static_assert( plain.str() == "text"sv );
+
+  CHECK_EQ( osm::styled( "bd blue", "bg white", "underlined" ).prefix(), "\033[1;34;107;4m"sv );
+  CHECK_EQ( std::string( label ), "\033[31;1mError:\033[0m" );
+
+  // Tables are the same data of the maps
+  CHECK_EQ( osm::styled( "lt cyan" ).prefix(), osm::feat( osm::col, "lt cyan" ) );
+  CHECK_EQ( osm::col.size(), std::size( osm::col_table ) );
+
+  // Errors
+  CHECK_THROWS_AS( osm::styled( "ciccio" ), std::runtime_error );
+  CHECK_THROWS_AS( osm::styled( "error" ), std::runtime_error );
+
+  // Stream insertion
+  std::ostringstream oss;
+  oss << label;
+  CHECK_EQ( oss.str(), "\033[31;1mError:\033[0m" );
+
+  osm::OPTION( osm::ESCAPES::OFF );
+  oss.str( "" );
+  oss << label;
+  CHECK_EQ( oss.str(), "Error:" );
+  osm::OPTION( osm::ESCAPES::ON );
+ }
+
+//====================================================
+//     Testing "feat" function on the constant tables
+//====================================================
+TEST_CASE( "Testing the feat function on the constant tables." )
+ {
+  using namespace std::literals::string_view_literals;
+
+  static_assert( osm::feat( osm::col_table, "red" ).sequence == "\033[31m"sv );
+  static_assert( osm::feat( osm::rst_table, "all" ).sequence == "\033[0m"sv );
+  CHECK_EQ( osm::feat( osm::sty_table, "bold" ).sequence, osm::feat( osm::sty, "bold" ) );
+#ifndef __cpp_consteval
+  CHECK_THROWS_AS( osm::feat( osm::col_table, "ciccio" ), std::runtime_error );
+#endif
+
+  std::ostringstream oss;
+  oss << osm::feat( osm::col_table, "red" ) << "Error" << osm::feat( osm::rst_table, "all" );
+  CHECK_EQ( oss.str(), "\033[31mError\033[0m" );
+
+  osm::OPTION( osm::ESCAPES::OFF );
+  oss.str( "" );
+  oss << osm::feat( osm::col_table, "red" ) << "Error";
+  CHECK_EQ( oss.str(), "Error" );
+  osm::OPTION( osm::ESCAPES::ON );
+ }
@@ -10,6 +10,8 @@
 //My headers
 #include <osmanip/manipulators/colsty.hpp>
 #include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/utility/options.hpp>
 
 //Extra headers
 #include <doctest/doctest.h>
@@ -202,6 +204,32 @@ TEST_CASE_TEMPLATE( "Testing the ProgressBar class methods.", T, int32_t, int64_
      }
    }
 
+  //====================================================
+  //     Testing the colors of the output
+  //====================================================
+  SUBCASE( "Testing the reset of the colors." )
+   {
+    const osm::ESCAPES escapes = osm::getEscapes();
+    osm::OPTION( osm::ESCAPES::ON );
+    osm::MemorySink sink;
+    osm::setSink( &sink );
+
+    // Only the color set by the bar is reset, so that the style of the caller is kept
+    bar.setMax( 10 );
+    bar.setMin( 0 );
+    bar.resetStyle();
+    bar.setStyle( type, "%" );
+    bar.setColor( color );
+    bar.update( 5 );
+    osm::setSink( nullptr );
+
+    CHECK_NE( sink.str().find( "\033[31m" ), std::string::npos );
+    CHECK_NE( sink.str().find( "\033[39m" ), std::string::npos );
+    CHECK_EQ( sink.str().find( "\033[0m" ), std::string::npos );
+
+    osm::OPTION( escapes );
+   }
+
   //====================================================
   //     Testing "addStyle" method
   //====================================================
@@ -0,0 +1,156 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_parser.hpp>
+#include <osmanip/utility/strings.hpp>
+#include <osmanip/manipulators/sgr.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <string>
+#include <string_view>
+
+//====================================================
+//     Helpers
+//====================================================
+
+// Writes the events as a readable log, e.g. "T(ab)C(10)CSI(?25l)"
+struct LogHandler: public osm::AnsiHandler
+{
+  std::string log;
+  osm::Style last_style;
+
+  void text( std::string_view run ) override { log += "T(" + std::string( run ) + ")"; }
+  void control( char code ) override { log += "C(" + std::to_string( code ) + ")"; }
+  void sgr( const osm::Style & style ) override { log += "SGR"; last_style = style; }
+  void esc( char final, char intermediate ) override { log += "ESC(" + ( intermediate ? std::string( 1, intermediate ) : "" ) + final + ")"; }
+  void osc( std::string_view data ) override { log += "OSC(" + std::string( data ) + ")"; }
+
+  void csi( const osm::AnsiCsi & csi ) override
+  {
+    log += "CSI(";
+    if( csi.prefix ) log += csi.prefix;
+    for( size_t i = 0; i < csi.size; ++i )
+    {
+      log += ( i ? ";" : "" ) + std::to_string( csi.params[ i ] );
+    }
+    if( csi.intermediate ) log += csi.intermediate;
+    log += csi.final;
+    log += ")";
+  }
+};
+
+TEST_CASE( "Testing the AnsiParser class." )
+{
+  osm::AnsiParser parser;
+  LogHandler handler;
+
+  SUBCASE( "Testing text runs and control characters." )
+  {
+    parser.feed( "ab\ncd\r", handler );
+    CHECK_EQ( handler.log, "T(ab)C(10)T(cd)C(13)" );
+    CHECK( parser.isGround() );
+  }
+
+  SUBCASE( "Testing CSI parameters." )
+  {
+    parser.feed( "\033[3A\033[12;40H\033[;5H\033[K\033[?25l\033[2 q", handler );
+    CHECK_EQ( handler.log, "CSI(3A)CSI(12;40H)CSI(0;5H)CSI(K)CSI(?25l)CSI(2 q)" );
+  }
+
+  SUBCASE( "Testing default parameters." )
+  {
+    osm::AnsiCsi csi {};
+    csi.size = 2;
+    csi.params[ 0 ] = 0;
+    csi.params[ 1 ] = 7;
+    CHECK_EQ( csi.param( 0, 1 ), 1 );
+    CHECK_EQ( csi.param( 1, 1 ), 7 );
+    CHECK_EQ( csi.param( 2, 1 ), 1 );
+  }
+
+  SUBCASE( "Testing SGR sequences." )
+  {
+    parser.feed( "\033[1;31mx\033[38;2;1;2;3m", handler );
+    CHECK_EQ( handler.log, "SGRT(x)SGR" );
+    CHECK( handler.last_style == osm::Style{ osm::Color::rgb( 1, 2, 3 ), {}, osm::ATTR::BOLD } );
+    CHECK( parser.style() == handler.last_style );
+
+    parser.feed( "\033[m", handler );
+    CHECK( parser.style().isDefault() );
+  }
+
+  SUBCASE( "Testing SGR sub-parameters." )
+  {
+    parser.feed( "\033[38:2::255:0:0m", handler );
+    CHECK( parser.style() == osm::Style{ osm::Color::rgb( 255, 0, 0 ), {}, osm::ATTR::NONE } );
+
+    parser.feed( "\033[0;4:3m", handler );
+    CHECK( parser.style().attrs == osm::ATTR::UNDERLINED );
+
+    parser.feed( "\033[4:0;48:5:196;58:2::1:2:3m", handler );
+    CHECK( parser.style() == osm::Style{ {}, osm::Color::indexed( 196 ), osm::ATTR::NONE } );
+  }
+
+  SUBCASE( "Testing OSC and other strings." )
+  {
+    parser.feed( "\033]0;title\007a\033]2;other\033\\b\033Pignored\033\\c", handler );
+    CHECK_EQ( handler.log, "OSC(0;title)T(a)OSC(2;other)T(b)T(c)" );
+  }
+
+  SUBCASE( "Testing escape sequences." )
+  {
+    parser.feed( "\0337\033(B\0338", handler );
+    CHECK_EQ( handler.log, "ESC(7)ESC((B)ESC(8)" );
+  }
+
+  SUBCASE( "Testing sequences split between chunks." )
+  {
+    const std::string_view stream = "ab\033[1;31mcd\033[12;40Hef\033]0;t\007";
+    for( char c: stream )
+    {
+      parser.feed( std::string_view( &c, 1 ), handler );
+    }
+    CHECK_EQ( handler.log, "T(a)T(b)SGRT(c)T(d)CSI(12;40H)T(e)T(f)OSC(0;t)" );
+
+    parser.feed( "x\033[1", handler );
+    CHECK( ! parser.isGround() );
+    parser.feed( "2Cy", handler );
+    CHECK( parser.isGround() );
+  }
+
+  SUBCASE( "Testing cancelled and malformed sequences." )
+  {
+    parser.feed( "\033[12\030a\033[1\033[2Jb\033[1?5hc", handler );
+    CHECK_EQ( handler.log, "T(a)CSI(2J)T(b)T(c)" );
+  }
+
+  SUBCASE( "Testing reset." )
+  {
+    parser.feed( "\033[1m\033[12", handler );
+    parser.reset();
+    CHECK( parser.isGround() );
+    CHECK( parser.style().isDefault() );
+
+    parser.feed( "a", handler );
+    CHECK_EQ( handler.log, "SGRT(a)" );
+  }
+}
+
+TEST_CASE( "Testing get_formatted_from_ansi." )
+{
+  CHECK_EQ( osm::get_formatted_from_ansi( "\033[1;31mred\033[0m text" ), "red text" );
+  CHECK_EQ( osm::get_formatted_from_ansi( "abcd\033[2Dxy\n12\033[Dz" ), "abxy\n1z" );
+  CHECK_EQ( osm::get_formatted_from_ansi( "first\nsecond\033[1Athird" ), "firstthird\nsecond" );
+  CHECK_EQ( osm::get_formatted_from_ansi( "progress 10%\033[3D20%\033[?25l" ), "progress 20%" );
+  CHECK_EQ( osm::get_formatted_from_ansi( "abcdef\033[3D\033[K" ), "abc" );
+}
@@ -0,0 +1,80 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/ansi_scan.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <string>
+
+//====================================================
+//     find_escape and find_control
+//====================================================
+TEST_CASE( "Testing the find_escape and find_control functions." )
+{
+  // Every position of a string longer than a block, so that both the blocks and the tail are checked
+  for( size_t size = 1; size <= 100; size += 33 )
+  {
+    for( size_t at = 0; at < size; at++ )
+    {
+      std::string str( size, 'a' );
+      str[ at ] = '\033';
+      CHECK_EQ( osm::find_escape( str ), at );
+      CHECK_EQ( osm::find_control( str ), at );
+      CHECK_EQ( osm::find_escape( str, at + 1 ), std::string::npos );
+
+      str[ at ] = '\n';
+      CHECK_EQ( osm::find_escape( str ), std::string::npos );
+      CHECK_EQ( osm::find_control( str ), at );
+    }
+  }
+
+  // Bytes of UTF-8 sequences are not control characters
+  const std::string utf8 = "███████████ 100%\r";
+  CHECK_EQ( osm::find_control( utf8 ), utf8.size() - 1 );
+  CHECK_EQ( osm::find_control( utf8, 3 ), utf8.size() - 1 );
+  CHECK_EQ( osm::find_escape( "", 0 ), std::string::npos );
+  CHECK_EQ( osm::find_control( "ab", 5 ), std::string::npos );
+}
+
+//====================================================
+//     escape_size
+//====================================================
+TEST_CASE( "Testing the escape_size function." )
+{
+  CHECK_EQ( osm::escape_size( "\033[31mred", 0 ), 5 );
+  CHECK_EQ( osm::escape_size( "a\033[?25l", 1 ), 6 );
+  CHECK_EQ( osm::escape_size( "\033]0;title\a!", 0 ), 10 );
+  CHECK_EQ( osm::escape_size( "\033]0;title\033\\!", 0 ), 11 );
+  CHECK_EQ( osm::escape_size( "\033]0;ti\033[1m", 0 ), 6 );
+  CHECK_EQ( osm::escape_size( "\033(B", 0 ), 3 );
+  CHECK_EQ( osm::escape_size( "\0337", 0 ), 2 );
+  CHECK_EQ( osm::escape_size( "\033[12", 0 ), 4 );
+  CHECK_EQ( osm::escape_size( "\033[1\n", 0 ), 3 );
+  CHECK_EQ( osm::escape_size( "\033", 0 ), 1 );
+}
+
+//====================================================
+//     strip_ansi
+//====================================================
+TEST_CASE( "Testing the strip_ansi function." )
+{
+  CHECK_EQ( osm::strip_ansi( "" ), "" );
+  CHECK_EQ( osm::strip_ansi( "no escapes\n" ), "no escapes\n" );
+  CHECK_EQ( osm::strip_ansi( osm::feat( osm::col, "red" ) + "Error:" + osm::feat( osm::rst, "all" ) + " failed\n" ), "Error: failed\n" );
+  CHECK_EQ( osm::strip_ansi( "\033]0;title\a\033[2K\r\0337\033[1;1Hx\0338\033" ), "\rx" );
+
+  std::string out = "> ";
+  osm::strip_ansi( "\033[1mbold\033[0m", out );
+  CHECK_EQ( out, "> bold" );
+}
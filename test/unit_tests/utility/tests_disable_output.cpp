@@ -0,0 +1,111 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_IMPLEMENT
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/terminal.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/cursor.hpp>
+#include <osmanip/manipulators/printer.hpp>
+#include <osmanip/progressbar/progress_bar.hpp>
+#include <osmanip/progressbar/multi_progress_bar.hpp>
+#include <osmanip/graphics/canvas.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <ostream>
+#include <stdint.h>
+
+//====================================================
+//     Main
+//====================================================
+
+// Only these tests are built with OSMANIP_DISABLE_OUTPUT, since the others check the disabled output
+int main( int argc, char** argv )
+{
+  doctest::Context context;
+  context.applyCommandLine( argc, argv );
+  return context.run();
+}
+
+//====================================================
+//     Testing the OSMANIP_DISABLE_OUTPUT mode
+//====================================================
+TEST_CASE( "Testing the OSMANIP_DISABLE_OUTPUT mode." )
+{
+  static_assert( ! osm::OUTPUT_ENABLED );
+
+  osm::MemorySink sink;
+  osm::setSink( &sink );
+
+  SUBCASE( "Testing escape sequences." )
+  {
+    CHECK( ! osm::escapes_enabled() );
+    CHECK( ! osm::colors_enabled() );
+    CHECK_EQ( osm::feat( osm::col, "red" ), "" );
+    CHECK_EQ( osm::feat( osm::crs, "up", 3 ), "" );
+    CHECK_EQ( osm::cursor_up( 3 ), "" );
+  }
+
+  SUBCASE( "Testing osm::cout and print." )
+  {
+    // Text is still written, without its styles
+    osm::cout << osm::feat( osm::col, "red" ) << "text " << osm::feat( osm::rst, "all" ) << std::flush;
+    osm::print( "{:red,bold} done\n", "job" );
+    osm::cout.flush();
+    CHECK_EQ( sink.str(), "text job done\n" );
+  }
+
+  SUBCASE( "Testing progress bars and canvases." )
+  {
+    osm::ProgressBar<int32_t> bar;
+    bar.setMin( 0 );
+    bar.setMax( 10 );
+    bar.setStyle( "complete", "%", "#" );
+    for( int32_t i = bar.getMin(); i < bar.getMax(); i++ )
+    {
+      bar.update( i );
+    }
+
+    osm::Canvas canvas( 3, 2 );
+    canvas.enableFrame( true );
+    canvas.put( 1, 1, 'x', osm::feat( osm::col, "red" ) );
+    canvas.refresh();
+
+    osm::cout.flush();
+    CHECK_EQ( sink.str(), "" );
+  }
+
+  SUBCASE( "Testing the callbacks of MultiProgressBar." )
+  {
+    osm::ProgressBar<int32_t> bar1, bar2;
+    auto bars = osm::MultiProgressBar( bar1, bar2 );
+
+    // Callbacks run as with output enabled, only the drawing is a no-op
+    int32_t calls = 0;
+    bars.for_each( [ & ]( auto & bar ) { bar.setMax( 20 ); calls++; } );
+    bars.for_one( 1, [ & ]( auto & bar ) { bar.setMin( 5 ); calls++; } );
+    bars.for_each( osm::updater{}, 7 );
+    CHECK_EQ( calls, 3 );
+    CHECK_EQ( bar1.getMax(), 20 );
+    CHECK_EQ( bar2.getMax(), 20 );
+    CHECK_EQ( bar1.getMin(), 0 );
+    CHECK_EQ( bar2.getMin(), 5 );
+
+    osm::cout.flush();
+    CHECK_EQ( sink.str(), "" );
+  }
+
+  osm::setSink( nullptr );
+}
@@ -0,0 +1,57 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/display_width.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <string>
+
+//====================================================
+//     char_width
+//====================================================
+TEST_CASE( "Testing the char_width function." )
+{
+  CHECK_EQ( osm::char_width( U'a' ), 1 );
+  CHECK_EQ( osm::char_width( U'\n' ), 0 );
+  CHECK_EQ( osm::char_width( U'\u0085' ), 0 );
+  CHECK_EQ( osm::char_width( U'é' ), 1 );
+  CHECK_EQ( osm::char_width( U'\u0301' ), 0 );      // Combining acute accent
+  CHECK_EQ( osm::char_width( U'\u200D' ), 0 );      // Zero width joiner
+  CHECK_EQ( osm::char_width( U'█' ), 1 );      // Full block
+  CHECK_EQ( osm::char_width( U'　' ), 2 );      // Ideographic space
+  CHECK_EQ( osm::char_width( U'日' ), 2 );
+  CHECK_EQ( osm::char_width( U'가' ), 2 );      // Hangul syllable
+  CHECK_EQ( osm::char_width( U'Ａ' ), 2 );      // Fullwidth A
+  CHECK_EQ( osm::char_width( U'\U0001F600' ), 2 );
+  CHECK_EQ( osm::char_width( U'\U00020000' ), 2 );
+  CHECK_EQ( osm::char_width( U'\U000E0001' ), 0 );
+}
+
+//====================================================
+//     display_width
+//====================================================
+TEST_CASE( "Testing the display_width function." )
+{
+  CHECK_EQ( osm::display_width( "" ), 0 );
+  CHECK_EQ( osm::display_width( "plain ASCII text, longer than a word\n" ), 36 );
+  CHECK_EQ( osm::display_width( "[███████   ] 70%" ), 16 );
+  CHECK_EQ( osm::display_width( "日本語のテキスト" ), 16 );
+  CHECK_EQ( osm::display_width( "e\xCC\x81te\xCC\x81" ), 3 );      // Combining acute accents
+  CHECK_EQ( osm::display_width( osm::feat( osm::col, "red" ) + "Error:" + osm::feat( osm::rst, "all" ) + " 失敗" ), 11 );
+  CHECK_EQ( osm::display_width( "\033]0;title\a\033[2K\rdone" ), 4 );
+
+  // Malformed UTF-8 takes one cell per byte, as the replacement character
+  CHECK_EQ( osm::display_width( "a\xE6\x97" ), 3 );
+  CHECK_EQ( osm::display_width( "\xFF\xC3(" ), 3 );
+}
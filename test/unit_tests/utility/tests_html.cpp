@@ -0,0 +1,75 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/html.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <sstream>
+#include <string>
+
+//====================================================
+//     HtmlConverter
+//====================================================
+TEST_CASE( "Testing the HtmlConverter class." )
+{
+  SUBCASE( "Testing text and escaping." )
+  {
+    CHECK_EQ( osm::ansi_to_html( "" ), "" );
+    CHECK_EQ( osm::ansi_to_html( "a < b && c > d\n\ttab\r\a" ), "a &lt; b &amp;&amp; c &gt; d\n\ttab" );
+    CHECK_EQ( osm::ansi_to_html( "\033]0;title\a\033[2K\033[1Adone" ), "done" );
+  }
+
+  SUBCASE( "Testing styles." )
+  {
+    CHECK_EQ( osm::ansi_to_html( osm::feat( osm::col, "red" ) + "Error:" + osm::feat( osm::rst, "all" ) + " failed" ),
+              "<span style=\"color:#cd0000\">Error:</span> failed" );
+    CHECK_EQ( osm::ansi_to_html( "\033[1;3;4;9;48;5;196m<b>\033[0m" ),
+              "<span style=\"background-color:#ff0000;font-weight:bold;font-style:italic;text-decoration:underline line-through\">&lt;b&gt;</span>" );
+    CHECK_EQ( osm::ansi_to_html( "\033[38;2;1;2;255mrgb\033[7minverse" ),
+              "<span style=\"color:#0102ff\">rgb</span><span style=\"color:#000000;background-color:#0102ff\">inverse</span>" );
+    CHECK_EQ( osm::ansi_to_html( "\033[5mblink\033[0m" ), "blink" );
+  }
+
+  SUBCASE( "Testing minimal markup." )
+  {
+    // Runs with the same style share a span, styles without text produce nothing
+    CHECK_EQ( osm::ansi_to_html( "\033[32ma\033[32mb\033[1m\033[22mc\033[0m\033[31m\033[0md" ), "<span style=\"color:#00cd00\">abc</span>d" );
+    CHECK_EQ( osm::ansi_to_html( "\033[32mopen" ), "<span style=\"color:#00cd00\">open</span>" );
+  }
+
+  SUBCASE( "Testing streamed conversion." )
+  {
+    const std::string input = "\033[1mbold\033[0m plain\n";
+    std::string expected;
+    std::string stream;
+    for( size_t i = 0; i < 5000; i++ )
+    {
+      stream += input;
+      expected += "<span style=\"font-weight:bold\">bold</span> plain\n";
+    }
+
+    std::istringstream in( stream );
+    std::ostringstream out;
+    osm::HtmlConverter::convert( in, out );
+    CHECK_EQ( out.str(), expected );
+
+    // Sequences split between chunks
+    std::ostringstream split;
+    osm::HtmlConverter converter( split );
+    converter.feed( "x\033[3" );
+    converter.feed( "1my" );
+    converter.end();
+    CHECK_EQ( split.str(), "x<span style=\"color:#cd0000\">y</span>" );
+  }
+}
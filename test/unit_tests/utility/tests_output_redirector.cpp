@@ -2,8 +2,16 @@
 //     Headers
 //====================================================
 
+// Platform headers
+#ifndef _WIN32
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 // My headers
 #include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/html.hpp>
 #include <osmanip/progressbar/progress_bar.hpp>
 
 // Extra headers
@@ -12,6 +20,11 @@
 // STD headers
 #include <thread>
 #include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
 //====================================================
 //     Aliases
@@ -61,6 +74,10 @@ TEST_CASE( "Testing OutputRedirector class" )
   SUBCASE( "Testing naked getters and constructor." )
    {
     CHECK_EQ( osm::redirout.getFilename(), default_filename );
+    CHECK_EQ( osm::OutputRedirector::DEFAULT_FILENAME, default_filename );
+    CHECK_EQ( fs::path( osm::OutputRedirector::DEFAULT_FILEPATH.str() ), default_filepath );
+    CHECK_EQ( fs::path( osm::redirout.getFilepath() ), default_filepath );
+    CHECK_EQ( osm::redirout.isEnabled(), false );
    }
 
 //   SUBCASE( "Testing setters and getters with initialized values." )
@@ -133,6 +150,344 @@ TEST_CASE( "Testing OutputRedirector class" )
 
   TEST_SUITE_BEGIN( "Output redirection." );
 
+  //====================================================
+  //     Testing rendering of the redirected output
+  //====================================================
+  SUBCASE( "Testing rendering of the redirected output." )
+   {
+    osm::redirout.begin();
+    osm::cout << "Loading:\n\033[1;31m0%\033[0m" << std::flush;
+    osm::cout << "\033[2D50%\033[3D100%\n" << std::flush;
+    osm::cout << "first\nsecond\033[1A\033[2D__\033[1B\n" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "Loading:\n100%\nfirs__\nsecond\n" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing osm::redirout as a stream." )
+   {
+    const auto write_line = []( std::ostream & os, const std::string & line ) { os << line << std::endl; };
+
+    osm::redirout.begin();
+    osm::redirout << "value " << std::hex << 255 << std::dec << "\n";
+    write_line( osm::redirout, "as a std::ostream" );
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "value ff\nas a std::ostream\n" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  //====================================================
+  //     Testing incremental redirection
+  //====================================================
+  SUBCASE( "Testing incremental redirection." )
+   {
+    std::string expected;
+
+    // More lines than the screen holds, so that most of them are appended
+    osm::redirout.begin();
+    for( size_t i = 0; i < 3 * osm::OutputRedirector::SCREEN_HEIGHT; i++ )
+     {
+      osm::cout << "line " << i << "\n" << std::flush;
+      expected += "line " + std::to_string( i ) + "\n";
+     }
+    osm::cout << "0%" << std::flush << "\033[2D100%\n" << std::flush;
+    osm::redirout.end();
+
+    expected += "100%\n";
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), expected );
+
+    // The file is resumed, with the last lines still on the screen
+    osm::redirout.begin();
+    osm::cout << "\033[1Adone\n" << std::flush;
+    osm::redirout.end();
+
+    expected.replace( expected.size() - 5, 5, "done\n" );
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), expected );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing in-place rewriting of changed lines." )
+   {
+    osm::redirout.begin();
+    osm::cout << "first 100%\nsecond\n" << std::flush;
+
+    // A line which becomes shorter is padded, so that the following ones stay in place
+    osm::cout << "\033[2A\033[2Kfirst 5%\033[2B\r" << std::flush;
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "first 5%  \nsecond\n" );
+    osm::cout << "\033[2A\033[2Kfirst 50%\033[2B\r" << std::flush;
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "first 50% \nsecond\n" );
+
+    // The last line is never padded
+    osm::cout << "0%" << std::flush << "\033[2D10%" << std::flush << "\033[3D\033[K9%" << std::flush;
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "first 50% \nsecond\n9%" );
+
+    // A line which does not fit its place moves the following ones
+    osm::cout << "\033[1A\033[3Gcond line\033[1B\r" << std::flush;
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "first 50% \nsecond line\n9%" );
+
+    // The padding is removed when the line scrolls off the screen
+    std::string lines;
+    for( size_t i = 0; i < osm::OutputRedirector::SCREEN_HEIGHT; i++ ) lines += "\n";
+    osm::cout << lines << std::flush;
+    CHECK_EQ( read_file( osm::redirout.getFilename() ).substr( 0, 10 ), "first 50%\n" );
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "first 50%\nsecond line\n9%" + lines );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing rotation of the file." )
+   {
+    const std::string filename = osm::redirout.getFilename();
+    std::string expected;
+
+    osm::redirout.setMaxSize( 4000, 2 );
+    osm::redirout.begin();
+    for( size_t i = 0; i < 1000; i++ )
+     {
+      osm::cout << "line " << 1000 + i << "\n" << std::flush;
+      expected += "line " + std::to_string( 1000 + i ) + "\n";
+     }
+    osm::redirout.end();
+    osm::redirout.setMaxSize( 0 );
+
+    // The last output is kept, split in files of at least half the maximum size
+    const std::string first = read_file( filename + ".2" ), second = read_file( filename + ".1" ), current = read_file( filename );
+    CHECK( file_exists( filename + ".2" ) );
+    CHECK( !file_exists( filename + ".3" ) );
+    CHECK( first.size() >= 2000 );
+    CHECK( second.size() >= 2000 );
+    CHECK( current.size() <= 4000 + osm::OutputRedirector::SCREEN_HEIGHT * 10 );
+    CHECK_EQ( expected.substr( expected.size() - current.size() ), current );
+    CHECK_EQ( expected.substr( expected.size() - current.size() - second.size() - first.size() ), first + second + current );
+
+    delete_file( filename + ".1" );
+    delete_file( filename + ".2" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing a rotation which fails." )
+   {
+    const std::string filename = osm::redirout.getFilename();
+    std::string expected;
+
+    // The file cannot be renamed over a directory which is not empty, so the output is kept in the file
+    fs::create_directories( filename + ".1/kept" );
+    osm::redirout.setMaxSize( 4000 );
+    osm::redirout.begin();
+    for( size_t i = 0; i < 1000; i++ )
+     {
+      osm::cout << "line " << 1000 + i << "\n" << std::flush;
+      expected += "line " + std::to_string( 1000 + i ) + "\n";
+     }
+    osm::redirout.end();
+    osm::redirout.setMaxSize( 0 );
+
+    CHECK_EQ( read_file( filename ), expected );
+    CHECK( fs::is_directory( filename + ".1/kept" ) );
+
+    fs::remove_all( filename + ".1" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing tee mode." )
+   {
+    auto & cout_buf = static_cast<osm::Ostreambuf &>( *osm::cout.rdbuf() );
+    std::ostream * terminal = cout_buf.getOstream();
+    std::ostringstream captured;
+    cout_buf.setOstream( &captured );
+
+    // The stream receives the raw output, the file its rendered text
+    osm::redirout.setTee( true );
+    CHECK( osm::redirout.isTee() );
+    osm::redirout.begin();
+    osm::cout << "\033[1;32m0%\033[0m" << std::flush << "\r100%\n" << std::flush;
+    osm::redirout.end();
+    osm::redirout.setTee( false );
+
+    CHECK_EQ( captured.str(), "\033[1;32m0%\033[0m\r100%\n" );
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "100%\n" );
+
+    // Without tee mode, only the file receives the output
+    osm::redirout.begin();
+    osm::cout << "file only\n" << std::flush;
+    osm::redirout.end();
+    CHECK_EQ( captured.str(), "\033[1;32m0%\033[0m\r100%\n" );
+
+    cout_buf.setOstream( terminal );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing styled mode." )
+   {
+    // The file keeps the styles of the rendered lines, which can then be converted to HTML
+    osm::redirout.setStyled( true );
+    CHECK( osm::redirout.isStyled() );
+    osm::redirout.begin();
+    osm::cout << "\033[1;32m0%\033[0m" << std::flush << "\r\033[1;32m100%\033[0m done\n" << std::flush;
+    osm::redirout.end();
+    osm::redirout.setStyled( false );
+
+    const std::string styled = read_file( osm::redirout.getFilename() );
+    CHECK_EQ( styled, "\033[1;32m100%\033[0m done\n" );
+    CHECK_EQ( osm::ansi_to_html( styled ), "<span style=\"color:#00cd00;font-weight:bold\">100%</span> done\n" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  SUBCASE( "Testing redirection after the contents of a file." )
+   {
+    std::ofstream( osm::redirout.getFilename() ) << "previous\nlast";
+    osm::redirout.setFilename( osm::redirout.getFilename() );
+
+    osm::redirout.begin();
+    osm::cout << " line\nnew\n" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "previous\nlast line\nnew\n" );
+
+    // Tabs, carriage returns and control characters are kept, both in the previous contents and in the new output
+    std::ofstream( osm::redirout.getFilename(), std::ios::binary ) << "col1\tcol2\r\nrow\abell";
+    osm::redirout.setFilename( osm::redirout.getFilename() );
+
+    osm::redirout.begin();
+    osm::cout << "\na\tb\r\n" << std::flush;
+    osm::cout << "c\td\n" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "col1\tcol2\r\nrow\abell\na\tb\r\nc\td\n" );
+
+    // Only the lines the cursor can move back over are read, the earlier ones are left as they are
+    std::string lines;
+    for( size_t i = 0; i < osm::OutputRedirector::SCREEN_HEIGHT; i++ ) lines += "line\n";
+    std::ofstream( osm::redirout.getFilename(), std::ios::binary ) << "\033[1mbold\033[0m\n" << lines;
+    osm::redirout.setFilename( osm::redirout.getFilename() );
+
+    osm::redirout.begin();
+    osm::cout << "\033[1Aedited\n" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "\033[1mbold\033[0m\n" + lines.substr( 5 ) + "edited\n" );
+
+    // Final lines which are not rendered as they are written are not rewritten
+    std::ofstream( osm::redirout.getFilename(), std::ios::binary ) << "x\033[1my";
+    osm::redirout.setFilename( osm::redirout.getFilename() );
+
+    osm::redirout.begin();
+    osm::cout << "z\n" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), "x\033[1myz\n" );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+  //====================================================
+  //     Testing asynchronous redirection
+  //====================================================
+  SUBCASE( "Testing asynchronous redirection." )
+   {
+    std::string expected;
+
+    osm::redirout.setAsync( true, 64 );
+    CHECK( osm::redirout.isAsync() );
+
+    // Everything handed over is in the file after a flush, even if the producers had to wait for room
+    osm::redirout.begin();
+    for( size_t i = 0; i < 3 * osm::OutputRedirector::SCREEN_HEIGHT; i++ )
+     {
+      osm::cout << "line " << i << "\n" << std::flush;
+      expected += "line " + std::to_string( i ) + "\n";
+     }
+    osm::redirout.flush();
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), expected );
+
+    osm::cout << "0%" << std::flush << "\033[2D100%\n" << std::flush;
+    osm::redirout.end();
+    CHECK_EQ( read_file( osm::redirout.getFilename() ), expected + "100%\n" );
+
+    // Output which does not fit the buffer is discarded, the rest is written
+    delete_file( osm::redirout.getFilename() );
+    osm::redirout.setFilename( osm::redirout.getFilename() );
+    osm::redirout.setAsync( true, 1, osm::OVERFLOW_POLICY::DROP );
+    const size_t dropped = osm::redirout.getDroppedSize();
+
+    osm::redirout.begin();
+    for( size_t i = 0; i < 1000; i++ ) osm::cout << "x" << std::flush;
+    osm::redirout.end();
+
+    CHECK_EQ( read_file( osm::redirout.getFilename() ).size() + osm::redirout.getDroppedSize() - dropped, 1000 );
+
+    osm::redirout.setAsync( false );
+    CHECK( !osm::redirout.isAsync() );
+   }
+
+  delete_file( osm::redirout.getFilename() );
+
+#ifndef _WIN32
+  SUBCASE( "Testing the handling of fatal signals." )
+   {
+    // A previous handler taking the signal information, which ends the process
+    struct sigaction previous {}, chained {}, current {};
+    chained.sa_sigaction = []( int signal, siginfo_t * info, void * ) { _exit( info && info->si_signo == signal ? 42 : 1 ); };
+    chained.sa_flags = SA_SIGINFO;
+    sigemptyset( &chained.sa_mask );
+    sigaction( SIGTERM, &chained, &previous );
+
+    // The handlers are installed while a writer thread runs, then the previous ones are restored
+    {
+      osm::OutputRedirector redirector( TEST_FILENAME );
+      redirector.setAsync( true );
+      redirector << "x" << std::flush;
+      sigaction( SIGTERM, nullptr, &current );
+      CHECK( current.sa_sigaction != chained.sa_sigaction );
+      redirector.setAsync( false );
+      sigaction( SIGTERM, nullptr, &current );
+      CHECK( current.sa_sigaction == chained.sa_sigaction );
+    }
+    delete_file( TEST_FILENAME );
+
+    // The output of more redirectors than a block of slots holds is written before the previous handler is called
+    const size_t count = 20;
+    if( const pid_t child = fork(); child == 0 )
+     {
+      std::vector<std::unique_ptr<osm::OutputRedirector>> redirectors;
+      for( size_t i = 0; i < count; i++ )
+       {
+        redirectors.push_back( std::make_unique<osm::OutputRedirector>( "test_signal_" + std::to_string( i ) + ".txt" ) );
+        redirectors.back()->setAsync( true );
+        *redirectors.back() << "drained " << i << "\n" << std::flush;
+       }
+      raise( SIGTERM );
+      _exit( 1 );
+     }
+    else
+     {
+      int status = 0;
+      waitpid( child, &status, 0 );
+      CHECK( WIFEXITED( status ) );
+      CHECK_EQ( WEXITSTATUS( status ), 42 );
+     }
+
+    for( size_t i = 0; i < count; i++ )
+     {
+      const std::string filename = "test_signal_" + std::to_string( i ) + ".txt";
+      CHECK_EQ( read_file( filename ), "drained " + std::to_string( i ) + "\n" );
+      delete_file( filename );
+     }
+    sigaction( SIGTERM, &previous, nullptr );
+   }
+#endif
+
   //====================================================
   //     Testing "output redirection" feature
   //====================================================
@@ -0,0 +1,249 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/screen.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/cursor.hpp>
+#include <osmanip/manipulators/style_registry.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <stdexcept>
+#include <string>
+
+TEST_CASE( "Testing the Screen class." )
+{
+  osm::Screen screen( 10, 4 );
+
+  SUBCASE( "Testing text and new lines." )
+  {
+    screen.write( "abc\ndef" );
+    CHECK_EQ( screen.str(), "abc\ndef" );
+    CHECK_EQ( screen.cursorRow(), 1 );
+    CHECK_EQ( screen.cursorCol(), 3 );
+
+    screen.write( "\n" );
+    CHECK_EQ( screen.str(), "abc\ndef\n" );
+    CHECK_THROWS_AS( osm::Screen( 0, 1 ), std::invalid_argument );
+  }
+
+  SUBCASE( "Testing UTF-8 characters." )
+  {
+    screen.write( "[\xE2\x96" );
+    screen.write( "\xA0]" );
+    CHECK( screen.at( 0, 1 ).ch == U'\u25A0' );
+    CHECK_EQ( screen.str(), "[■]" );
+  }
+
+  SUBCASE( "Testing cursor movements." )
+  {
+    screen.write( "first\nsecond\033[1A\033[2D__" );
+    CHECK_EQ( screen.str(), "firs__\nsecond" );
+
+    screen.write( "\033[3;5HX\033[1;1HY\033[GZ\033[2CW\033[1B\033[1;10H\033[5CV" );
+    CHECK_EQ( screen.str( 0 ), "ZirW__   V" );
+    CHECK_EQ( screen.str( 2 ), "    X" );
+    CHECK_EQ( screen.cursorCol(), 9 );
+
+    screen.write( "\r\033[100D\033[20A" );
+    CHECK_EQ( screen.cursorRow(), 0 );
+    CHECK_EQ( screen.cursorCol(), 0 );
+  }
+
+  SUBCASE( "Testing line and display erasures." )
+  {
+    screen.write( "0123456789\n0123456789\n0123456789\033[2;5H" );
+
+    screen.write( "\033[K" );
+    CHECK_EQ( screen.str( 1 ), "0123" );
+    screen.write( "\033[1;5H\033[1K" );
+    CHECK_EQ( screen.str( 0 ), "     56789" );
+    screen.write( "\033[3;5H\033[2K" );
+    CHECK_EQ( screen.str( 2 ), "" );
+
+    screen.write( "\033[1;7H\033[J" );
+    CHECK_EQ( screen.str(), "     5" );
+    screen.write( "\033[2J" );
+    CHECK_EQ( screen.str(), "" );
+  }
+
+  SUBCASE( "Testing scrolling and the scrollback." )
+  {
+    screen.write( "1\n2\n3\n4\n5\n6" );
+    CHECK_EQ( screen.scrollback().size(), 2 );
+    CHECK_EQ( screen.str( 0 ), "3" );
+    CHECK_EQ( screen.str(), "1\n2\n3\n4\n5\n6" );
+
+    osm::Screen limited( 10, 2, 1 );
+    limited.write( "1\n2\n3\n4" );
+    CHECK_EQ( limited.str(), "2\n3\n4" );
+
+    std::string text = ">";
+    screen.takeScrollback( text );
+    CHECK_EQ( text, ">1\n2\n" );
+    CHECK_EQ( screen.scrollback().size(), 0 );
+    screen.appendScreen( text );
+    CHECK_EQ( text, ">1\n2\n3\n4\n5\n6" );
+
+    screen.write( "\n7" );
+    CHECK_EQ( screen.str(), "3\n4\n5\n6\n7" );
+
+    screen.write( "\033[3J" );
+    CHECK_EQ( screen.scrollback().size(), 0 );
+  }
+
+  SUBCASE( "Testing the tracking of changed rows." )
+  {
+    osm::RowRange changed = screen.takeChangedRows();
+    CHECK_EQ( changed.first, 0 );
+    CHECK_EQ( changed.last, 4 );
+    CHECK_EQ( screen.usedRows(), 1 );
+
+    screen.write( "a\nb\033[1;1Hx\033[2;1H" );
+    changed = screen.takeChangedRows();
+    CHECK_EQ( changed.first, 0 );
+    CHECK_EQ( changed.last, 2 );
+    CHECK_EQ( screen.takeChangedRows().last, 0 );
+
+    // Lines moved to the scrollback move the changed rows with them
+    screen.write( "\033[4;1Hc\033[2;1Hy\033[4;1H\n\n" );
+    changed = screen.takeChangedRows();
+    CHECK_EQ( screen.scrollback().size(), 2 );
+    CHECK_EQ( changed.first, 0 );
+    CHECK_EQ( changed.last, 4 );
+
+    std::string text;
+    osm::Screen::appendLine( text, screen.scrollback()[ 1 ] );
+    CHECK_EQ( text, "y" );
+    screen.dropScrollback();
+    CHECK_EQ( screen.scrollback().size(), 0 );
+    CHECK_EQ( screen.usedRows(), 4 );
+
+    // Moving the cursor changes nothing, deleting lines changes the rows below
+    screen.write( "\033[1;1H\033[2;3H" );
+    CHECK_EQ( screen.takeChangedRows().last, 0 );
+    screen.write( "\033[M" );
+    changed = screen.takeChangedRows();
+    CHECK_EQ( changed.first, 1 );
+    CHECK_EQ( changed.last, 4 );
+  }
+
+  SUBCASE( "Testing scroll regions." )
+  {
+    screen.write( "a\nb\nc\nd\033[2;3r" );
+    CHECK_EQ( screen.cursorRow(), 0 );
+
+    screen.write( "\033[3;1H\nx" );
+    CHECK_EQ( screen.str(), "a\nc\nx\nd" );
+    CHECK_EQ( screen.scrollback().size(), 0 );
+
+    screen.write( "\033[2;1H\033M" );
+    CHECK_EQ( screen.str(), "a\n\nc\nd" );
+
+    screen.write( "\033[2;1H\033[L" );
+    CHECK_EQ( screen.str(), "a\n\n\nd" );
+  }
+
+  SUBCASE( "Testing line wrapping." )
+  {
+    screen.write( "0123456789" );
+    CHECK_EQ( screen.cursorRow(), 0 );
+
+    screen.write( "abc" );
+    CHECK_EQ( screen.cursorRow(), 1 );
+    CHECK( screen.line( 0 ).wrapped );
+    CHECK_EQ( screen.str(), "0123456789abc" );
+  }
+
+  SUBCASE( "Testing character insertion and deletion." )
+  {
+    screen.write( "abcdef\033[1;3H\033[2P" );
+    CHECK_EQ( screen.str(), "abef" );
+    screen.write( "\033[2@" );
+    CHECK_EQ( screen.str(), "ab  ef" );
+    screen.write( "\033[1;1H\033[3X" );
+    CHECK_EQ( screen.str(), "    ef" );
+  }
+
+  SUBCASE( "Testing styles and cursor saving." )
+  {
+    screen.write( osm::feat( osm::col, "red" ) + "r" + osm::feat( osm::rst, "all" ) + "d" );
+    CHECK( screen.at( 0, 0 ).style == osm::styles::red );
+    CHECK( screen.at( 0, 1 ).style.isDefault() );
+
+    screen.write( "\0337\033[3;3Hx\0338y\033[sz\033[4;4H\033[uw" );
+    CHECK_EQ( screen.str(), "rdyw\n\n  x" );
+
+    screen.write( "\033c" );
+    CHECK_EQ( screen.str(), "" );
+  }
+
+  SUBCASE( "Testing styled lines." )
+  {
+    screen.write( "\033[1;31mab\033[0mc\033[4m d\r\n\033[0mplain" );
+    std::string text;
+    osm::Screen::appendLine( text, screen.line( 0 ), true );
+    CHECK_EQ( text, "\033[1;31mab\033[0mc\033[4m d\033[0m\r" );
+
+    // Unstyled lines are unchanged, and a styled line is rendered again as it was
+    text.clear();
+    osm::Screen::appendLine( text, screen.line( 1 ), true );
+    CHECK_EQ( text, "plain" );
+
+    osm::Screen copy;
+    text.clear();
+    osm::Screen::appendLine( text, screen.line( 0 ), true );
+    copy.write( text );
+    CHECK( copy.at( 0, 1 ).style == screen.at( 0, 1 ).style );
+    CHECK( copy.at( 0, 3 ).style == screen.at( 0, 3 ).style );
+  }
+
+  SUBCASE( "Testing more distinct styles than the style registry holds." )
+  {
+    // Styles of the output are stored in the cells, not interned
+    const size_t interned = osm::interned_styles();
+    std::string output;
+    for( size_t i = 0; i <= osm::STYLE_REGISTRY_SIZE; i++ )
+    {
+      output += "\033[38;2;" + std::to_string( i >> 8 & 0xFF ) + ";" + std::to_string( i & 0xFF ) + ";" + std::to_string( i >> 16 ) + "mx\r";
+    }
+    CHECK_NOTHROW( screen.write( output ) );
+    CHECK_EQ( osm::interned_styles(), interned );
+    CHECK( screen.at( 0, 0 ).style.fg == osm::Color::rgb( 0, 0, 1 ) );
+  }
+
+  SUBCASE( "Testing a line redrawn in place." )
+  {
+    screen.write( "Loading:\n0%" );
+    for( int percent = 10; percent <= 100; percent += 10 )
+    {
+      screen.write( osm::feat( osm::crs, "left", 100 ) + std::to_string( percent ) + "%" );
+    }
+    CHECK_EQ( screen.str(), "Loading:\n100%" );
+  }
+
+  SUBCASE( "Testing tabs, carriage returns and control characters kept in the text." )
+  {
+    screen.write( "a\tb\r\nc\ad\tx" );
+    CHECK_EQ( screen.str(), "a\tb\r\nc\ad\tx" );
+    CHECK_EQ( screen.cursorCol(), 9 );
+
+    screen.write( "\n\a\n\r\033[4CQ" );
+    CHECK_EQ( screen.str(), "a\tb\r\nc\ad\tx\n\a\n    Q" );
+
+    screen.write( "\033[3A\r\033[4CQ" );
+    CHECK_EQ( screen.str(), "a   Q   b\r\nc\ad\tx\n\a\n    Q" );
+
+    screen.write( "\033[H\033[2K" );
+    CHECK_EQ( screen.str(), "\nc\ad\tx\n\a\n    Q" );
+  }
+}
@@ -0,0 +1,168 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// Platform headers
+#ifndef _WIN32
+#include <signal.h>
+#endif
+
+// My headers
+#include <osmanip/utility/sink.hpp>
+#include <osmanip/utility/iostream.hpp>
+#include <osmanip/utility/output_redirector.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+//====================================================
+//     Helpers
+//====================================================
+std::string read_sink_file( const std::string & filename )
+{
+  std::ifstream file( filename, std::ios::binary );
+  std::ostringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+//====================================================
+//     Sinks
+//====================================================
+TEST_CASE( "Testing the Sink classes." )
+{
+  SUBCASE( "Testing MemorySink and CallbackSink." )
+  {
+    osm::MemorySink memory;
+    memory.write( "abc" );
+    memory.write( "" );
+    memory.write( "def" );
+    CHECK_EQ( memory.str(), "abcdef" );
+    memory.clear();
+    CHECK_EQ( memory.str(), "" );
+
+    std::string written;
+    int flushes = 0;
+    osm::CallbackSink callback( [ & ]( std::string_view data ) { written.append( data ); }, [ & ]() { ++flushes; } );
+    callback.write( "xyz" );
+    callback.flush();
+    CHECK_EQ( written, "xyz" );
+    CHECK_EQ( flushes, 1 );
+
+    // The flush function is optional
+    osm::CallbackSink write_only( [ & ]( std::string_view data ) { written.append( data ); } );
+    write_only.write( "!" );
+    write_only.flush();
+    CHECK_EQ( written, "xyz!" );
+  }
+
+#ifndef _WIN32
+  SUBCASE( "Testing FdSink and PipeSink." )
+  {
+    const std::string filename = "test_sink_fd.txt";
+    FILE * file = std::fopen( filename.c_str(), "wb" );
+    REQUIRE( file != nullptr );
+    {
+      // Small writes are buffered, a large one is written together with the buffer
+      osm::FdSink sink( fileno( file ), 8 );
+      sink.write( "abc" );
+      sink.write( "de" );
+      CHECK_EQ( read_sink_file( filename ), "" );
+      sink.write( "fghijklmn" );
+      CHECK_EQ( read_sink_file( filename ), "abcdefghijklmn" );
+      sink.write( "op" );
+      sink.flush();
+      CHECK_EQ( read_sink_file( filename ), "abcdefghijklmnop" );
+      sink.write( "q" );
+    }
+    CHECK_EQ( read_sink_file( filename ), "abcdefghijklmnopq" );
+    std::fclose( file );
+
+    osm::FdSink closed( -1, 0 );
+    CHECK_THROWS_AS( closed.write( "x" ), std::runtime_error );
+
+    {
+      osm::PipeSink pipe( "cat > " + filename );
+      pipe.write( "through " );
+      pipe.write( "a pipe\n" );
+      CHECK_EQ( pipe.close(), 0 );
+      CHECK_EQ( pipe.close(), -1 );
+      CHECK_THROWS_AS( pipe.write( "x" ), std::runtime_error );
+    }
+    CHECK_EQ( read_sink_file( filename ), "through a pipe\n" );
+    std::remove( filename.c_str() );
+
+    // A command which has exited makes the writes throw, without SIGPIPE ending the process
+    {
+      osm::PipeSink exited( "exit 0" );
+      const std::string data( 1 << 20, 'x' );
+      const auto write_data = [ & ]() { exited.write( data ); exited.flush(); };
+      CHECK_THROWS_AS( write_data(), std::runtime_error );
+    }
+    sigset_t pending;
+    sigpending( &pending );
+    CHECK( sigismember( &pending, SIGPIPE ) == 0 );
+  }
+#endif
+
+  SUBCASE( "Testing RedirectorSink." )
+  {
+    osm::OutputRedirector redirector( "test_sink_redirector.txt" );
+    redirector.begin();
+    {
+      osm::RedirectorSink sink( redirector );
+      sink.write( "a\033[1Db" );
+      sink.write( "\n" );
+      sink.flush();
+    }
+    redirector.end();
+    CHECK_EQ( read_sink_file( redirector.getFilename() ), "b\n" );
+    std::remove( redirector.getFilename().c_str() );
+  }
+}
+
+//====================================================
+//     osm::cout
+//====================================================
+TEST_CASE( "Testing sinks behind osm::cout." )
+{
+  REQUIRE( osm::getSink() == nullptr );
+
+  osm::MemorySink memory;
+  osm::setSink( &memory );
+  CHECK( osm::getSink() == &memory );
+  osm::cout << "\033[1;32m50%\033[0m" << std::flush;
+  CHECK_EQ( memory.str(), "\033[1;32m50%\033[0m" );
+
+  // The output is passed on each flush, through the callback of another sink
+  std::string written;
+  osm::CallbackSink callback( [ & ]( std::string_view data ) { written.append( data ).push_back( '|' ); } );
+  osm::cout << "pending";
+  osm::setSink( &callback );
+  CHECK_EQ( memory.str(), "\033[1;32m50%\033[0mpending" );
+  osm::cout << "one" << std::flush << "two" << std::endl;
+  CHECK_EQ( written, "one|two\n|" );
+
+  // A failing sink sets the badbit of osm::cout
+  osm::CallbackSink failing( []( std::string_view ) { throw std::runtime_error( "failed" ); } );
+  osm::setSink( &failing );
+  osm::cout << "lost" << std::flush;
+  CHECK( osm::cout.bad() );
+  osm::cout.clear();
+
+  osm::setSink( nullptr );
+  CHECK( osm::getSink() == nullptr );
+}
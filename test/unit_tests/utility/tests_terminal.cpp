@@ -0,0 +1,120 @@
+//====================================================
+//     Preprocessor settings
+//====================================================
+#define DOCTEST_CONFIG_SUPER_FAST_ASSERTS
+
+//====================================================
+//     Headers
+//====================================================
+
+// My headers
+#include <osmanip/utility/terminal.hpp>
+#include <osmanip/utility/options.hpp>
+#include <osmanip/manipulators/common.hpp>
+#include <osmanip/manipulators/colsty.hpp>
+#include <osmanip/manipulators/cursor.hpp>
+
+// Extra headers
+#include <doctest/doctest.h>
+
+// STD headers
+#include <string>
+#include <sstream>
+#include <cstdlib>
+#include <optional>
+
+#ifndef _WIN32
+//====================================================
+//     Helpers
+//====================================================
+
+// Restores an environment variable to its original value when going out of scope
+class EnvGuard
+{
+  public:
+  explicit EnvGuard( const char * name ):
+   name_( name )
+  {
+    if( const char * value = std::getenv( name ) )
+    {
+      value_ = value;
+    }
+  }
+
+  ~EnvGuard()
+  {
+    if( value_ )
+    {
+      setenv( name_, value_->c_str(), 1 );
+    }
+    else
+    {
+      unsetenv( name_ );
+    }
+  }
+
+  EnvGuard( const EnvGuard & ) = delete;
+  EnvGuard & operator=( const EnvGuard & ) = delete;
+
+  private:
+  const char * name_;
+  std::optional<std::string> value_;
+};
+#endif
+
+TEST_CASE( "Testing the terminal capabilities." )
+{
+  SUBCASE( "Testing terminal caching." )
+  {
+    CHECK_EQ( &osm::terminal(), &osm::terminal() );
+  }
+
+  SUBCASE( "Testing escapes suppression." )
+  {
+    osm::OPTION( osm::ESCAPES::OFF );
+    CHECK_EQ( osm::getEscapes(), osm::ESCAPES::OFF );
+    CHECK( ! osm::escapes_enabled() );
+    CHECK_EQ( osm::color_depth(), osm::COLORDEPTH::NONE );
+
+    CHECK_EQ( osm::feat( osm::col, "red" ), "" );
+    CHECK_EQ( osm::feat( osm::sty, "bold" ), "" );
+    CHECK_EQ( osm::feat( osm::crs, "up", 3 ), "" );
+    CHECK_EQ( osm::feat( osm::tcs, "crt" ), "\r" );
+    CHECK_EQ( osm::RGB( 1, 2, 3 ), "" );
+    CHECK_EQ( osm::cursor_up( 3 ), "" );
+    CHECK_EQ( osm::feat( osm::tcs, "hcrs" ), "" );
+
+    std::ostringstream oss;
+    osm::cursor_to( oss, 2, 4 );
+    CHECK_EQ( oss.str(), "" );
+
+    osm::OPTION( osm::ESCAPES::ON );
+    CHECK_EQ( osm::feat( osm::col, "red" ), "\033[31m" );
+    CHECK_EQ( osm::cursor_up( 3 ), "\033[3A" );
+  }
+
+#ifndef _WIN32
+  SUBCASE( "Testing probe_terminal." )
+  {
+    const EnvGuard term( "TERM" ), colorterm( "COLORTERM" ), clicolor_force( "CLICOLOR_FORCE" ), no_color( "NO_COLOR" );
+
+    setenv( "TERM", "xterm-256color", 1 );
+    unsetenv( "COLORTERM" );
+    CHECK_EQ( osm::probe_terminal().color_depth, osm::COLORDEPTH::C256 );
+
+    setenv( "COLORTERM", "truecolor", 1 );
+    CHECK_EQ( osm::probe_terminal().color_depth, osm::COLORDEPTH::TRUECOLOR );
+
+    setenv( "CLICOLOR_FORCE", "1", 1 );
+    CHECK( osm::probe_terminal().ansi );
+    CHECK( osm::probe_terminal().color );
+
+    setenv( "NO_COLOR", "1", 1 );
+    CHECK( osm::probe_terminal().ansi );
+    CHECK( ! osm::probe_terminal().color );
+
+    setenv( "TERM", "dumb", 1 );
+    CHECK( ! osm::probe_terminal().ansi );
+  }
+#endif
+}